@@ -1,5 +1,7 @@
 #pragma once
 
+#include "BoostImplementations/BoostAsyncCommunicationTask.hpp"
+#include "BoostImplementations/BoostAsyncRWer.hpp"
 #include "BoostImplementations/BoostRWer.hpp"
 #include "BoostImplementations/BoostRWerProvider.hpp"
 #include "BoostImplementations/BoostReadWrite.hpp"
@@ -0,0 +1,287 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/detached.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/this_coro.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <Cango/ByteCommunication/Core/PCer.hpp>
+
+#include "BoostAsyncRWer.hpp"
+#include "BoostRWer.hpp"
+
+namespace Cango :: inline ByteCommunication :: inline BoostImplementations {
+	/// @brief @c DeliveryTaskAsRWerConsumer 的异步版本，读取和写入都是同一线程上的协程
+	///	@details
+	///		读取协程使用 ReadSome 取走所有可用的字节，由 @c RingFramer 分帧后交给消息目标；
+	///		写入协程从消息源获取消息并写入，消息源为空时等待 WriterMinInterval 而不占用线程。
+	///		任意一方结束时中断另一方的监视器并关闭设备，@c Execute 在两者都结束后返回。
+	///		Counters 即分帧器的计数器，设置后还记录写出的字节数和重新连接的次数。
+	///	@note 运行此对象的 io_context 只能由一个线程运行，或使用 strand 作为执行器
+	template <
+		IsAsyncRWer TRWer,
+		IsVerifier TReaderMessageVerifier,
+		IsItemDestination TReaderMessageDestination,
+		IsItemSource TWriterMessageSource,
+		IsDeliveryTaskMonitor TReaderMonitor,
+		IsDeliveryTaskMonitor TWriterMonitor,
+		SizeType TCapacity = SizeType{1} << 16>
+	class AsyncDeliveryTaskAsRWerConsumer final {
+		using ReaderMessageType = typename TReaderMessageDestination::ItemType;
+		using WriterMessageType = typename TWriterMessageSource::ItemType;
+		using FramerType = MessageRingFramer<ReaderMessageType, TReaderMessageVerifier, TCapacity>;
+
+		Owner<FramerType> Framer{};
+		Credential<TReaderMessageDestination> ReaderMessageDestination{};
+		Credential<TWriterMessageSource> WriterMessageSource{};
+		Credential<TReaderMonitor> ReaderMonitor{};
+		Credential<TWriterMonitor> WriterMonitor{};
+		std::chrono::milliseconds WriterMinInterval{1};
+		std::uint64_t ConnectionCount{0};
+
+		struct Configurations {
+			struct ActorsType {
+				Credential<TReaderMessageDestination>& ReaderMessageDestination;
+				Credential<TWriterMessageSource>& WriterMessageSource;
+				Credential<TReaderMonitor>& ReadingMonitor;
+				Credential<TWriterMonitor>& WritingMonitor;
+				ObjectUser<ConnectionCounters>& Counters;
+			} Actors;
+
+			struct OptionsType {
+				ByteType& HeadByte;
+				TReaderMessageVerifier& ReaderMessageVerifier;
+				std::chrono::milliseconds& WriterMinInterval;
+			} Options;
+		};
+
+		boost::asio::awaitable<void> ReadLoop(
+			TRWer& rw,
+			TReaderMessageDestination& destination,
+			TReaderMonitor& monitor) noexcept {
+			auto& framer = *Framer;
+			ReaderMessageType message{};
+			const ByteSpan message_span{reinterpret_cast<ByteType*>(&message), sizeof(ReaderMessageType)};
+			while (!monitor.IsDone()) {
+				const auto bytes = co_await rw.ReadSome(framer.WritableSpan());
+				if (bytes == 0) break;
+				framer.Commit(bytes);
+				if (framer.Counters) framer.Counters->BytesRead.Add(bytes);
+				while (framer.Examine(message_span)) destination.SetItem(message);
+			}
+		}
+
+		boost::asio::awaitable<void> WriteLoop(
+			TRWer& rw,
+			TWriterMessageSource& source,
+			TWriterMonitor& monitor,
+			boost::asio::steady_timer& sleeper) noexcept {
+			WriterMessageType message{};
+			while (!monitor.IsDone()) {
+				if (source.GetItem(message)) {
+					const auto bytes = MessageToBytes(message);
+					const auto written = co_await rw.WriteBytes(bytes);
+					if (const auto& counters = Framer->Counters) counters->BytesWritten.Add(written);
+					if (written != bytes.size()) break;
+					continue;
+				}
+				boost::system::error_code result{};
+				sleeper.expires_after(WriterMinInterval);
+				co_await sleeper.async_wait(boost::asio::redirect_error(boost::asio::use_awaitable, result));
+			}
+		}
+
+	public:
+		[[nodiscard]] Configurations Configure() noexcept {
+			return {
+				.Actors = {ReaderMessageDestination, WriterMessageSource, ReaderMonitor, WriterMonitor, Framer->Counters},
+				.Options = {Framer->HeadByte, Framer->Verifier, WriterMinInterval}
+			};
+		}
+
+		[[nodiscard]] bool IsFunctional() const noexcept {
+			return Validate(ReaderMessageDestination, WriterMessageSource, ReaderMonitor, WriterMonitor);
+		}
+
+		/// @brief 在当前执行器上通过读写器通信，直到连接断开或被中断
+		boost::asio::awaitable<void> Execute(const ObjectUser<TRWer> rw) noexcept {
+			const auto destination_user = ReaderMessageDestination.lock();
+			const auto source_user = WriterMessageSource.lock();
+			const auto reader_monitor_user = ReaderMonitor.lock();
+			const auto writer_monitor_user = WriterMonitor.lock();
+			if (!destination_user || !source_user || !reader_monitor_user || !writer_monitor_user || !rw) co_return;
+
+			if (const auto& counters = Framer->Counters; counters && ConnectionCount != 0) counters->Reconnects.Add();
+			++ConnectionCount;
+
+			auto& reader_monitor = *reader_monitor_user;
+			auto& writer_monitor = *writer_monitor_user;
+			reader_monitor.Reset();
+			writer_monitor.Reset();
+
+			const auto executor = co_await boost::asio::this_coro::executor;
+			boost::asio::steady_timer sleeper{executor};
+			boost::asio::steady_timer writer_done{executor, boost::asio::steady_timer::time_point::max()};
+			bool is_writer_running{true};
+
+			boost::asio::co_spawn(
+				executor,
+				[&]() -> boost::asio::awaitable<void> {
+					co_await WriteLoop(*rw, *source_user, writer_monitor, sleeper);
+					reader_monitor.Interrupt();
+					rw->Close();
+					is_writer_running = false;
+					writer_done.cancel();
+				},
+				boost::asio::detached);
+
+			co_await ReadLoop(*rw, *destination_user, reader_monitor);
+			writer_monitor.Interrupt();
+			rw->Close();
+			sleeper.cancel();
+
+			while (is_writer_running) {
+				boost::system::error_code result{};
+				co_await writer_done.async_wait(boost::asio::redirect_error(boost::asio::use_awaitable, result));
+			}
+		}
+	};
+
+	/// @brief @c CommunicationTask 的异步版本，单设备获取、通信任务
+	///	@details
+	///		使用与同步版本相同的 @c BoostRWer 提供者，获取到的设备包装为 @c BoostAsyncRWer 后由协程通信。
+	///		多个任务可以在同一个 io_context 线程上运行，等待数据时不占用线程。
+	///		提供者的 GetItem 可能阻塞(如等待 TCP 连接)，设置 ProviderPool 后将在线程池中调用，否则在当前线程调用。
+	///	@note 运行此对象的 io_context 只能由一个线程运行，或使用 strand 作为执行器
+	template <
+		IsRWerProvider TProvider,
+		IsDeliveryTaskMonitor TProviderMonitor,
+		IsVerifier TReaderMessageVerifier,
+		IsItemDestination TReaderMessageDestination,
+		IsItemSource TWriterMessageSource,
+		IsDeliveryTaskMonitor TReaderMonitor,
+		IsDeliveryTaskMonitor TWriterMonitor>
+	class AsyncCommunicationTask {
+		using ProvidedRWerType = typename TProvider::ItemType::element_type;
+		using RWerType = BoostAsyncRWer<typename ProvidedRWerType::DeviceType>;
+		using RWerConsumerType = AsyncDeliveryTaskAsRWerConsumer<
+			RWerType,
+			TReaderMessageVerifier,
+			TReaderMessageDestination,
+			TWriterMessageSource,
+			TReaderMonitor,
+			TWriterMonitor>;
+
+		Credential<TProvider> Provider{};
+		Credential<TProviderMonitor> ProviderMonitor{};
+		Credential<boost::asio::thread_pool> ProviderPool{};
+		std::chrono::milliseconds ProviderMinInterval{};
+		Owner<RWerConsumerType> RWerConsumer{};
+
+		struct Configurations {
+			struct ActorsType {
+				Credential<TProvider>& Provider;
+				Credential<TReaderMessageDestination>& ReaderMessageDestination;
+				Credential<TWriterMessageSource>& WriterMessageSource;
+				Credential<TProviderMonitor>& ProviderMonitor;
+				Credential<TReaderMonitor>& ReaderMonitor;
+				Credential<TWriterMonitor>& WriterMonitor;
+				Credential<boost::asio::thread_pool>& ProviderPool;
+				/// @brief 见 @c ConnectionCounters ，为空时不计数
+				ObjectUser<ConnectionCounters>& Counters;
+			} Actors;
+
+			struct OptionsType {
+				ByteType& HeadByte;
+				TReaderMessageVerifier& ReaderMessageVerifier;
+				std::chrono::milliseconds& WriterMinInterval;
+				std::chrono::milliseconds& ProviderMinInterval;
+			} Options;
+		};
+
+		[[nodiscard]] boost::asio::awaitable<bool> GetRWer(TProvider& provider, typename TProvider::ItemType& rw) {
+			if (const auto pool_user = ProviderPool.lock())
+				co_return co_await boost::asio::co_spawn(
+					pool_user->get_executor(),
+					[&]() -> boost::asio::awaitable<bool> { co_return provider.GetItem(rw); },
+					boost::asio::use_awaitable);
+			co_return provider.GetItem(rw);
+		}
+
+	public:
+		using ProviderType = TProvider;
+		using ProviderTaskMonitorType = TProviderMonitor;
+		using ReaderMessageVerifierType = TReaderMessageVerifier;
+		using ReaderMessageDestinationType = TReaderMessageDestination;
+		using WriterMessageSourceType = TWriterMessageSource;
+		using ReaderTaskMonitorType = TReaderMonitor;
+		using WriterTaskMonitorType = TWriterMonitor;
+
+		Configurations Configure() noexcept {
+			auto&& consumer = RWerConsumer->Configure();
+			return {
+				.Actors = {
+					Provider,
+					consumer.Actors.ReaderMessageDestination,
+					consumer.Actors.WriterMessageSource,
+					ProviderMonitor,
+					consumer.Actors.ReadingMonitor,
+					consumer.Actors.WritingMonitor,
+					ProviderPool,
+					consumer.Actors.Counters
+				},
+				.Options = {
+					consumer.Options.HeadByte,
+					consumer.Options.ReaderMessageVerifier,
+					consumer.Options.WriterMinInterval,
+					ProviderMinInterval
+				}
+			};
+		}
+
+		[[nodiscard]] bool IsFunctional() noexcept {
+			return Validate(Provider, ProviderMonitor) && RWerConsumer->IsFunctional();
+		}
+
+		/// @brief 在当前执行器上反复获取设备并通信，直到 ProviderMonitor 被中断
+		///	@details 使用 boost::asio::co_spawn(io_context, task.Execute(), boost::asio::detached) 启动
+		boost::asio::awaitable<void> Execute() {
+			const auto provider_user = Provider.lock();
+			const auto monitor_user = ProviderMonitor.lock();
+			if (!provider_user || !monitor_user) co_return;
+
+			auto& provider = *provider_user;
+			auto& monitor = *monitor_user;
+			boost::asio::steady_timer sleeper{co_await boost::asio::this_coro::executor};
+			while (!monitor.IsDone()) {
+				typename TProvider::ItemType rw{};
+				if (co_await GetRWer(provider, rw) && rw) {
+					const Owner<RWerType> async_rw{rw->DeviceOwner, rw->Logger};
+					co_await RWerConsumer->Execute(ObjectUser<RWerType>{async_rw});
+				}
+
+				boost::system::error_code result{};
+				sleeper.expires_after(ProviderMinInterval);
+				co_await sleeper.async_wait(boost::asio::redirect_error(boost::asio::use_awaitable, result));
+			}
+		}
+	};
+
+	/// @brief 消息池的选择见 @c EasyCommunicationTaskPoolsAndMonitors
+	template <
+		IsRWerProvider TProvider,
+		std::default_initializable TReaderMessage,
+		std::default_initializable TWriterMessage,
+		IsItemSource TWriterMessagePool = AsyncItemPool<TWriterMessage>,
+		IsItemDestination TReaderMessagePool = AsyncItemPool<TReaderMessage>>
+	using EasyAsyncCommunicationTask = AsyncCommunicationTask<
+		TProvider,
+		EasyDeliveryTaskMonitor,
+		TailZeroVerifier,
+		TReaderMessagePool,
+		TWriterMessagePool,
+		EasyDeliveryTaskMonitor,
+		EasyDeliveryTaskMonitor>;
+}
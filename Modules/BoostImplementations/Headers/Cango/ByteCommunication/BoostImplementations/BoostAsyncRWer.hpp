@@ -0,0 +1,119 @@
+#pragma once
+
+#include <concepts>
+#include <boost/asio/awaitable.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/ip/udp.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/redirect_error.hpp>
+#include <boost/asio/serial_port.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <boost/asio/write.hpp>
+#include <Cango/CommonUtils/ObjectOwnership.hpp>
+#include <Cango/ByteCommunication/Core/ByteTypes.hpp>
+#include <spdlog/logger.h>
+
+namespace Cango :: inline ByteCommunication :: inline BoostImplementations {
+	/// @brief 异步 @c Reader 的概念，读取操作为协程，使用 co_await 等待结果
+	///	@details ReadBytes 等待缓冲区填满，ReadSome 在读到任意字节后返回
+	template <typename TObject>
+	concept IsAsyncReader = requires(TObject& object, ByteSpan buffer) {
+		{ object.ReadBytes(buffer) } -> std::same_as<boost::asio::awaitable<SizeType>>;
+		{ object.ReadSome(buffer) } -> std::same_as<boost::asio::awaitable<SizeType>>;
+	};
+
+	/// @brief 异步 @c Writer 的概念，写入操作为协程，使用 co_await 等待结果
+	template <typename TObject>
+	concept IsAsyncWriter = requires(TObject& object, CByteSpan buffer) {
+		{ object.WriteBytes(buffer) } -> std::same_as<boost::asio::awaitable<SizeType>>;
+	};
+
+	/// @brief 异步 @c RWer 的概念，Close 用于取消所有未完成的操作
+	template <typename TObject>
+	concept IsAsyncRWer = IsAsyncReader<TObject> && IsAsyncWriter<TObject> && requires(TObject& object) {
+		object.Close();
+	};
+
+	/// @brief 基于 boost::asio 协程的异步读写器，等待期间不占用线程
+	///	@details
+	///		可以由 @c BoostRWer 的设备构造，同一个 io_context 线程可以同时服务任意多个异步读写器。
+	///		因 @c Close 而取消的操作不记录错误
+	template <typename TBoostDevice>
+	struct BoostAsyncRWer final {
+		using DeviceType = TBoostDevice;
+
+		Owner<TBoostDevice> DeviceOwner;
+		ObjectUser<spdlog::logger> Logger;
+
+		BoostAsyncRWer(const Owner<TBoostDevice>& deviceOwner, const ObjectUser<spdlog::logger>& logger) :
+			DeviceOwner(deviceOwner),
+			Logger(logger) {
+		}
+
+		/// @brief 读取字节，直到缓冲区填满或发生错误
+		///	@return 读取到的字节数
+		[[nodiscard]] boost::asio::awaitable<SizeType> ReadBytes(const ByteSpan buffer) noexcept {
+			boost::system::error_code result{};
+			SizeType bytes;
+			if constexpr (std::same_as<TBoostDevice, boost::asio::ip::udp::socket>)
+				bytes = co_await DeviceOwner->async_receive(
+					boost::asio::buffer(buffer.data(), buffer.size()),
+					boost::asio::redirect_error(boost::asio::use_awaitable, result));
+			else
+				bytes = co_await boost::asio::async_read(
+					*DeviceOwner,
+					boost::asio::buffer(buffer.data(), buffer.size()),
+					boost::asio::redirect_error(boost::asio::use_awaitable, result));
+			if (result.failed() && result != boost::asio::error::operation_aborted && Logger)
+				Logger->error("异步读取字节失败({}/{}): {}", bytes, buffer.size(), result.what());
+			co_return bytes;
+		}
+
+		/// @brief 读取当前可用的字节，至少读到一个字节后返回
+		///	@return 读取到的字节数
+		[[nodiscard]] boost::asio::awaitable<SizeType> ReadSome(const ByteSpan buffer) noexcept {
+			boost::system::error_code result{};
+			SizeType bytes;
+			if constexpr (std::same_as<TBoostDevice, boost::asio::ip::udp::socket>)
+				bytes = co_await DeviceOwner->async_receive(
+					boost::asio::buffer(buffer.data(), buffer.size()),
+					boost::asio::redirect_error(boost::asio::use_awaitable, result));
+			else
+				bytes = co_await DeviceOwner->async_read_some(
+					boost::asio::buffer(buffer.data(), buffer.size()),
+					boost::asio::redirect_error(boost::asio::use_awaitable, result));
+			if (result.failed() && result != boost::asio::error::operation_aborted && Logger)
+				Logger->error("异步读取可用字节失败({}/{}): {}", bytes, buffer.size(), result.what());
+			co_return bytes;
+		}
+
+		/// @brief 写入所有字节，直到全部写入或发生错误
+		///	@return 写入的字节数
+		[[nodiscard]] boost::asio::awaitable<SizeType> WriteBytes(const CByteSpan buffer) noexcept {
+			boost::system::error_code result{};
+			SizeType bytes;
+			if constexpr (std::same_as<TBoostDevice, boost::asio::ip::udp::socket>)
+				bytes = co_await DeviceOwner->async_send(
+					boost::asio::buffer(buffer.data(), buffer.size()),
+					boost::asio::redirect_error(boost::asio::use_awaitable, result));
+			else
+				bytes = co_await boost::asio::async_write(
+					*DeviceOwner,
+					boost::asio::buffer(buffer.data(), buffer.size()),
+					boost::asio::redirect_error(boost::asio::use_awaitable, result));
+			if (result.failed() && result != boost::asio::error::operation_aborted && Logger)
+				Logger->error("异步写入字节失败({}/{}): {}", bytes, buffer.size(), result.what());
+			co_return bytes;
+		}
+
+		/// @brief 关闭设备，所有未完成的异步操作以 operation_aborted 结束
+		void Close() noexcept {
+			boost::system::error_code result{};
+			DeviceOwner->close(result);
+		}
+	};
+
+	using AsyncSerialPortRWer = BoostAsyncRWer<boost::asio::serial_port>;
+	using AsyncTCPSocketRWer = BoostAsyncRWer<boost::asio::ip::tcp::socket>;
+	using AsyncUDPSocketRWer = BoostAsyncRWer<boost::asio::ip::udp::socket>;
+}
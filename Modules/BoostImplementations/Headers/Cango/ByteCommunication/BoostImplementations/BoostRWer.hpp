@@ -10,6 +10,8 @@
 namespace Cango :: inline ByteCommunication :: inline BoostImplementations {
 	template <typename TBoostDevice>
 	struct BoostRWer final {
+		using DeviceType = TBoostDevice;
+
 		Owner<TBoostDevice> DeviceOwner;
 		ObjectUser<spdlog::logger> Logger;
 
@@ -32,6 +34,19 @@ namespace Cango :: inline ByteCommunication :: inline BoostImplementations {
 			return bytes;
 		}
 
+		/// @brief 读取当前可用的字节，至少读到一个字节或超时后返回，不等待缓冲区填满
+		///	@param buffer 提供给写入读取到的字节的缓冲区，可以远大于单个数据包，以便一次取走内核缓冲区中的所有字节
+		///	@param timeout 最长等待时间，超时不视为错误
+		///	@return 读取到的字节数，超时返回 0
+		///	@warning 此函数不检查 Device 是否指向正确对象，如果 Device 为 nullptr，将会引起段错误
+		[[nodiscard]] std::size_t ReadSome(const ByteSpan buffer, const TimeoutType timeout = NoTimeout) noexcept {
+			boost::system::error_code result{};
+			const auto bytes = Cango::ReadSomeBytes(*DeviceOwner, buffer, timeout, result);
+			if (result.failed() && result != boost::asio::error::timed_out && Logger)
+				Logger->error("读取可用字节失败({}/{}): {}", bytes, buffer.size(), result.what());
+			return bytes;
+		}
+
 		/// @brief 使用 boost 提供的函数写入字节
 		///	@param buffer 提供要写入的字节的缓冲区
 		///	@return 写入的字节数
@@ -43,6 +58,38 @@ namespace Cango :: inline ByteCommunication :: inline BoostImplementations {
 				Logger->error("写入字节失败({}/{}): {}", bytes, buffer.size(), result.what());
 			return bytes;
 		}
+
+		/// @brief 使用 boost 提供的缓冲区序列分散读取字节，只产生一次系统调用
+		///	@param buffers 依次填入读取到的字节的缓冲区
+		///	@return 读取到的总字节数
+		///	@warning 此函数不检查 Device 是否指向正确对象，如果 Device 为 nullptr，将会引起段错误
+		[[nodiscard]] std::size_t ReadBytesV(const ByteSpans buffers) noexcept {
+			boost::system::error_code result{};
+			const auto bytes = Cango::ReadBytesV(*DeviceOwner, buffers, result);
+			if (result.failed() && Logger)
+				Logger->error("分散读取字节失败({}/{}): {}", bytes, TotalSize(buffers), result.what());
+			return bytes;
+		}
+
+		/// @brief 使用 boost 提供的缓冲区序列聚集写入字节，只产生一次系统调用
+		///	@param buffers 依次提供要写入的字节的缓冲区
+		///	@return 写入的总字节数
+		///	@warning 此函数不检查 Device 是否指向正确对象，如果 Device 为 nullptr，将会引起段错误
+		[[nodiscard]] std::size_t WriteBytesV(const CByteSpans buffers) noexcept {
+			boost::system::error_code result{};
+			const auto bytes = Cango::WriteBytesV(*DeviceOwner, buffers, result);
+			if (result.failed() && Logger)
+				Logger->error("聚集写入字节失败({}/{}): {}", bytes, TotalSize(buffers), result.what());
+			return bytes;
+		}
+
+	private:
+		template <typename TSpan>
+		[[nodiscard]] static SizeType TotalSize(const std::span<const TSpan> buffers) noexcept {
+			SizeType total{0};
+			for (const auto buffer : buffers) total += buffer.size();
+			return total;
+		}
 	};
 
 	using SerialPortRWer = BoostRWer<boost::asio::serial_port>;
@@ -8,10 +8,12 @@ namespace Cango :: inline ByteCommunication :: inline BoostImplementations {
 	template <
 		IsRWerProvider TProvider,
 		std::default_initializable TReaderMessage,
-		std::default_initializable TWriterMessage>
+		std::default_initializable TWriterMessage,
+		IsItemSource TWriterMessagePool = AsyncItemPool<TWriterMessage>,
+		IsItemDestination TReaderMessagePool = AsyncItemPool<TReaderMessage>>
 	struct EasyRWerCommunicationTaskCheatsheet {
-		EasyCommunicationTask<TProvider, TReaderMessage, TWriterMessage> Task{};
-		EasyCommunicationTaskPoolsAndMonitors<TReaderMessage, TWriterMessage> Utils{};
+		EasyCommunicationTask<TProvider, TReaderMessage, TWriterMessage, TWriterMessagePool, TReaderMessagePool> Task{};
+		EasyCommunicationTaskPoolsAndMonitors<TReaderMessage, TWriterMessage, TWriterMessagePool, TReaderMessagePool> Utils{};
 		Owner<boost::asio::io_context> IOContext{};
 		Owner<TProvider> Provider{};
 
@@ -83,9 +85,13 @@ namespace Cango :: inline ByteCommunication :: inline BoostImplementations {
 		[[nodiscard]] bool GetItem(Owner<SerialPortRWer>& sp) const noexcept;
 	};
 
-	template <std::default_initializable TReaderMessage, std::default_initializable TWriterMessage>
+	template <
+		std::default_initializable TReaderMessage,
+		std::default_initializable TWriterMessage,
+		IsItemSource TWriterMessagePool = AsyncItemPool<TWriterMessage>,
+		IsItemDestination TReaderMessagePool = AsyncItemPool<TReaderMessage>>
 	using EasyCangoSerialPortRWerCommunicationTaskCheatsheet = EasyRWerCommunicationTaskCheatsheet<
-		CangoSerialPortRWerProvider, TReaderMessage, TWriterMessage>;
+		CangoSerialPortRWerProvider, TReaderMessage, TWriterMessage, TWriterMessagePool, TReaderMessagePool>;
 
 	template <typename TProvider, typename TRWer = typename TProvider::ItemType::element_type>
 	concept IsTCPSocketRWerProvider = IsRWerProvider<TProvider> && std::same_as<TCPSocketRWer, TRWer>;
@@ -127,9 +133,13 @@ namespace Cango :: inline ByteCommunication :: inline BoostImplementations {
 		[[nodiscard]] bool GetItem(Owner<TCPSocketRWer>& socket) noexcept;
 	};
 
-	template <std::default_initializable TReaderMessage, std::default_initializable TWriterMessage>
+	template <
+		std::default_initializable TReaderMessage,
+		std::default_initializable TWriterMessage,
+		IsItemSource TWriterMessagePool = AsyncItemPool<TWriterMessage>,
+		IsItemDestination TReaderMessagePool = AsyncItemPool<TReaderMessage>>
 	using EasyCangoTCPSocketRWerCommunicationTaskCheatsheet = EasyRWerCommunicationTaskCheatsheet<
-		CangoTCPSocketRWerProvider, TReaderMessage, TWriterMessage>;
+		CangoTCPSocketRWerProvider, TReaderMessage, TWriterMessage, TWriterMessagePool, TReaderMessagePool>;
 
 	class BoostTCPSocketRWerProvider {
 		bool IsListening{false};
@@ -165,9 +175,13 @@ namespace Cango :: inline ByteCommunication :: inline BoostImplementations {
 		[[nodiscard]] bool GetItem(Owner<TCPSocketRWer>& socket);
 	};
 
-	template <std::default_initializable TReaderMessage, std::default_initializable TWriterMessage>
+	template <
+		std::default_initializable TReaderMessage,
+		std::default_initializable TWriterMessage,
+		IsItemSource TWriterMessagePool = AsyncItemPool<TWriterMessage>,
+		IsItemDestination TReaderMessagePool = AsyncItemPool<TReaderMessage>>
 	using EasyBoostTCPSocketRWerCommunicationTaskCheatsheet = EasyRWerCommunicationTaskCheatsheet<
-		BoostTCPSocketRWerProvider, TReaderMessage, TWriterMessage>;
+		BoostTCPSocketRWerProvider, TReaderMessage, TWriterMessage, TWriterMessagePool, TReaderMessagePool>;
 
 	template <typename TProvider, typename TRWer = typename TProvider::ItemType::element_type>
 	concept IsUDPSocketRWerProvider = IsRWerProvider<TProvider> && std::same_as<UDPSocketRWer, TRWer>;
@@ -209,7 +223,11 @@ namespace Cango :: inline ByteCommunication :: inline BoostImplementations {
 		[[nodiscard]] bool GetItem(Owner<UDPSocketRWer>& socket) noexcept;
 	};
 
-	template <std::default_initializable TReaderMessage, std::default_initializable TWriterMessage>
+	template <
+		std::default_initializable TReaderMessage,
+		std::default_initializable TWriterMessage,
+		IsItemSource TWriterMessagePool = AsyncItemPool<TWriterMessage>,
+		IsItemDestination TReaderMessagePool = AsyncItemPool<TReaderMessage>>
 	using EasyCangoUDPSocketRWerCommunicationTaskCheatsheet = EasyRWerCommunicationTaskCheatsheet<
-		CangoUDPSocketRWerProvider, TReaderMessage, TWriterMessage>;
+		CangoUDPSocketRWerProvider, TReaderMessage, TWriterMessage, TWriterMessagePool, TReaderMessagePool>;
 }
@@ -1,9 +1,21 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <climits>
+#include <span>
+#include <boost/asio/error.hpp>
 #include <boost/asio/read.hpp>
 #include <boost/asio/write.hpp>
 #include <boost/asio/ip/udp.hpp>
 #include <Cango/ByteCommunication/Core/ByteTypes.hpp>
+#include <Cango/ByteCommunication/Core/RWer.hpp>
+
+#if !defined(BOOST_ASIO_WINDOWS)
+#include <cerrno>
+#include <poll.h>
+#endif
 
 namespace Cango :: inline ByteCommunication :: inline BoostImplementations {
 	template <typename TBoostDevice>
@@ -35,4 +47,109 @@ namespace Cango :: inline ByteCommunication :: inline BoostImplementations {
 		boost::asio::ip::udp::socket& device,
 		CByteSpan buffer,
 		boost::system::error_code& result) noexcept;
+
+	/// @brief 一次系统调用最多提交的缓冲区数量，超出部分分组提交
+	constexpr SizeType MaxBufferSequenceSize = 64;
+
+	/// @brief 将字节区间转换为 boost 缓冲区，按 @c MaxBufferSequenceSize 分组交给 transfer
+	///	@details 缓冲区序列放在栈上，不分配内存；任意一组传输不足时停止
+	///	@return 实际传输的总字节数
+	template <typename TBoostBuffer, typename TSpan, typename TTransfer>
+	SizeType TransferBufferSequence(const std::span<const TSpan> spans, TTransfer&& transfer) noexcept {
+		std::array<TBoostBuffer, MaxBufferSequenceSize> sequence{};
+		SizeType total{0};
+		for (SizeType begin = 0; begin < spans.size(); begin += MaxBufferSequenceSize) {
+			const auto count = std::min(MaxBufferSequenceSize, spans.size() - begin);
+			SizeType expected{0};
+			for (SizeType index = 0; index < count; ++index) {
+				const auto span = spans[begin + index];
+				sequence[index] = TBoostBuffer{span.data(), span.size()};
+				expected += span.size();
+			}
+			const auto bytes = transfer(std::span<const TBoostBuffer>{sequence.data(), count});
+			total += bytes;
+			if (bytes < expected) break;
+		}
+		return total;
+	}
+
+	/// @brief 分散读取，一次系统调用(readv)依次填满多个缓冲区
+	template <typename TBoostDevice>
+	SizeType ReadBytesV(
+		TBoostDevice& device,
+		const ByteSpans buffers,
+		boost::system::error_code& result) noexcept {
+		return TransferBufferSequence<boost::asio::mutable_buffer>(
+			buffers,
+			[&](const auto sequence) { return boost::asio::read(device, sequence, result); });
+	}
+
+	/// @brief 针对 udp socket 的写法，一次接收一个数据报，分散到多个缓冲区中
+	template <>
+	SizeType ReadBytesV<boost::asio::ip::udp::socket>(
+		boost::asio::ip::udp::socket& device,
+		ByteSpans buffers,
+		boost::system::error_code& result) noexcept;
+
+	/// @brief 聚集写入，一次系统调用(writev)依次写入多个缓冲区
+	template <typename TBoostDevice>
+	SizeType WriteBytesV(
+		TBoostDevice& device,
+		const CByteSpans buffers,
+		boost::system::error_code& result) noexcept {
+		return TransferBufferSequence<boost::asio::const_buffer>(
+			buffers,
+			[&](const auto sequence) { return boost::asio::write(device, sequence, result); });
+	}
+
+	/// @brief 针对 udp socket 的写法，不超过 @c MaxBufferSequenceSize 个缓冲区时合并为一个数据报发送
+	template <>
+	SizeType WriteBytesV<boost::asio::ip::udp::socket>(
+		boost::asio::ip::udp::socket& device,
+		CByteSpans buffers,
+		boost::system::error_code& result) noexcept;
+
+	/// @brief 等待设备可读，最多等待 timeout
+	///	@details
+	///		POSIX 平台上对设备的原生句柄调用 poll；Windows 平台上不支持等待时间，直接返回 true。
+	///		超时时 result 为 @c boost::asio::error::timed_out
+	///	@return 设备是否可读
+	template <typename TBoostDevice>
+	bool WaitReadable(
+		TBoostDevice& device,
+		const TimeoutType timeout,
+		boost::system::error_code& result) noexcept {
+		if (timeout == NoTimeout) return true;
+#if defined(BOOST_ASIO_WINDOWS)
+		return true;
+#else
+		const auto milliseconds = std::chrono::ceil<std::chrono::milliseconds>(std::max(timeout, TimeoutType::zero())).count();
+		pollfd descriptor{.fd = device.native_handle(), .events = POLLIN, .revents = 0};
+		const auto count = ::poll(&descriptor, 1, static_cast<int>(std::min<decltype(milliseconds)>(milliseconds, INT_MAX)));
+		if (count > 0) return true;
+		if (count == 0) result = boost::asio::error::timed_out;
+		else result = boost::system::error_code{errno, boost::system::system_category()};
+		return false;
+#endif
+	}
+
+	/// @brief 读取当前可用的字节，至少读到一个字节或超时后返回
+	///	@return 实际读取的字节数，超时返回 0
+	template <typename TBoostDevice>
+	SizeType ReadSomeBytes(
+		TBoostDevice& device,
+		const ByteSpan buffer,
+		const TimeoutType timeout,
+		boost::system::error_code& result) noexcept {
+		if (!WaitReadable(device, timeout, result)) return 0;
+		return device.read_some(boost::asio::buffer(buffer.data(), buffer.size()), result);
+	}
+
+	/// @brief 针对 udp socket 的写法，读取一个数据报
+	template <>
+	SizeType ReadSomeBytes<boost::asio::ip::udp::socket>(
+		boost::asio::ip::udp::socket& device,
+		ByteSpan buffer,
+		TimeoutType timeout,
+		boost::system::error_code& result) noexcept;
 }
@@ -22,4 +22,34 @@ namespace Cango :: inline ByteCommunication :: inline BoostImplementations {
 		catch (const boost::system::error_code& error) { result = error; }
 		return bytes;
 	}
+
+	template <>
+	SizeType ReadBytesV<boost::asio::ip::udp::socket>(
+		boost::asio::ip::udp::socket& device,
+		const ByteSpans buffers,
+		boost::system::error_code& result) noexcept {
+		return TransferBufferSequence<boost::asio::mutable_buffer>(
+			buffers,
+			[&](const auto sequence) { return device.receive(sequence, 0, result); });
+	}
+
+	template <>
+	SizeType WriteBytesV<boost::asio::ip::udp::socket>(
+		boost::asio::ip::udp::socket& device,
+		const CByteSpans buffers,
+		boost::system::error_code& result) noexcept {
+		return TransferBufferSequence<boost::asio::const_buffer>(
+			buffers,
+			[&](const auto sequence) { return device.send(sequence, 0, result); });
+	}
+
+	template <>
+	SizeType ReadSomeBytes<boost::asio::ip::udp::socket>(
+		boost::asio::ip::udp::socket& device,
+		const ByteSpan buffer,
+		const TimeoutType timeout,
+		boost::system::error_code& result) noexcept {
+		if (!WaitReadable(device, timeout, result)) return 0;
+		return device.receive(boost::asio::buffer(buffer.data(), buffer.size()), 0, result);
+	}
 }
@@ -0,0 +1,95 @@
+#include <Cango/ByteCommunication/BoostImplementations.hpp>
+#include <spdlog/spdlog.h>
+#include <fmt/ostream.h>
+
+using namespace Cango;
+using namespace std::chrono_literals;
+
+namespace {
+	constexpr int LinkCount = 4;
+	constexpr unsigned short FirstPort = 8989;
+
+	struct MessageType {
+		std::uint8_t Head{'!'};
+		std::array<std::uint8_t, 8> Data{};
+		std::uint8_t Tail{0};
+
+		friend std::ostream& operator<<(std::ostream& stream, const MessageType& object) noexcept {
+			for (const auto byte : object.Data) stream << static_cast<int>(byte) << ' ';
+			return stream;
+		}
+	};
+
+	/// @brief 一条连接所需的所有对象
+	struct Link {
+		EasyAsyncCommunicationTask<BoostTCPSocketRWerProvider, MessageType, MessageType> Task{};
+		EasyCommunicationTaskPoolsAndMonitors<MessageType, MessageType> Utils{};
+		Owner<BoostTCPSocketRWerProvider> Provider{};
+	};
+}
+
+template<>
+struct fmt::formatter<MessageType> : ostream_formatter {};
+
+/* 测试脚本，所有连接都在同一个 io_context 线程上通信，每个端口都会回显收到的前 10 条消息
+(echo -n -e '!01234567\0'; sleep 2)|telnet 127.0.0.1 8989
+(echo -n -e '!01234567\0'; sleep 2)|telnet 127.0.0.1 8990
+
+*/
+
+int main() {
+	spdlog::set_level(spdlog::level::debug);
+
+	const ObjectUser default_logger_user{spdlog::default_logger()};
+	Owner<boost::asio::io_context> io_context{};
+	Owner<boost::asio::thread_pool> provider_pool{LinkCount};
+
+	std::array<Link, LinkCount> links{};
+	for (int index = 0; index < LinkCount; ++index) {
+		auto& link = links[index];
+		{
+			auto&& [actors, options] = link.Provider->Configure();
+			actors.IOContext = io_context;
+			actors.ClientLogger = default_logger_user;
+			actors.Logger = default_logger_user;
+			options.LocalEndpoint = {
+				boost::asio::ip::make_address("127.0.0.1"),
+				static_cast<unsigned short>(FirstPort + index)
+			};
+		}
+		link.Utils.Apply(link.Task);
+		{
+			auto&& [actors, options] = link.Task.Configure();
+			actors.Provider = link.Provider;
+			actors.ProviderPool = provider_pool;
+			options.WriterMinInterval = 1ms;
+			options.ProviderMinInterval = 100ms;
+		}
+		boost::asio::co_spawn(*io_context, link.Task.Execute(), boost::asio::detached);
+	}
+
+	ThreadList threads{};
+	threads << [&io_context] { io_context->run(); };
+	for (auto& link : links)
+		threads << [&utils = link.Utils] {
+			auto& reader_pool = *utils.ReaderMessagePool;
+			auto& writer_pool = *utils.WriterMessagePool;
+
+			MessageType message{};
+			IntervalSleeper sleeper{std::chrono::milliseconds{100}};
+
+			for (int i = 0; i < 10; i++) {
+				while (!reader_pool.GetItem(message))
+					sleeper.Sleep();
+				spdlog::info("Reader> {}", message);
+				writer_pool.SetItem(message);
+			}
+
+			utils.ReaderMonitor->Interrupt();
+			utils.WriterMonitor->Interrupt();
+			utils.ProviderMonitor->Interrupt();
+		};
+	JoinThreads(threads);
+
+	return 0;
+}
@@ -34,7 +34,7 @@ int main() {
 	spdlog::set_level(spdlog::level::debug);
 
 	const ObjectUser default_logger_user{spdlog::default_logger()};
-	EasyBoostTCPSocketRWerCommunicationTaskCheatsheet<MessageType, MessageType> cheatsheet{};
+	EasyBoostTCPSocketRWerCommunicationTaskCheatsheet<MessageType, MessageType, NotifyingItemPool<MessageType>> cheatsheet{};
 	{
 		{
 			auto&& [actors, options] = cheatsheet.Provider->Configure();
@@ -51,7 +51,8 @@ int main() {
 			monitor->NormalHandler = []{};
 
 			options.ReaderMinInterval = 1ms;
-			options.WriterMinInterval = 5ms;
+			// 写入消息池在放入消息时唤醒写入任务，不需要轮询间隔
+			options.WriterMinInterval = 0ms;
 		}
 	}
 
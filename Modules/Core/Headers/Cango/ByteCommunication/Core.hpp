@@ -1,8 +1,25 @@
 #pragma once
 
+#include "Core/BufferedWriter.hpp"
+#include "Core/ByteSearch.hpp"
+#include "Core/ByteStuffing.hpp"
 #include "Core/ByteTypes.hpp"
+#include "Core/Capture.hpp"
+#include "Core/ChecksumVerifier.hpp"
+#include "Core/ComposedVerifier.hpp"
+#include "Core/ConnectionStatistics.hpp"
+#include "Core/CrcVerifier.hpp"
+#include "Core/DataField.hpp"
+#include "Core/LatencyHistogram.hpp"
+#include "Core/LoopbackRWer.hpp"
+#include "Core/MessageQueue.hpp"
+#include "Core/NotifyingItemPool.hpp"
 #include "Core/PCer.hpp"
 #include "Core/PPBuffer.hpp"
 #include "Core/RWer.hpp"
+#include "Core/RingFramer.hpp"
+#include "Core/ShapingRWer.hpp"
 #include "Core/TypedMessage.hpp"
+#include "Core/TypedMessageRouter.hpp"
+#include "Core/VariableFrame.hpp"
 #include "Core/Verifier.hpp"
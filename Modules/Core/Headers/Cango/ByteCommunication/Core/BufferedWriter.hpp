@@ -0,0 +1,223 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <utility>
+
+#include <Cango/CommonUtils/ObjectOwnership.hpp>
+
+#include "RWer.hpp"
+
+namespace Cango :: inline ByteCommunication :: inline Core {
+	/// @brief @c BufferedWriter 的统计数据快照
+	struct BufferedWriterStatistics {
+		/// @brief 调用 WriteBytes 的次数
+		std::uint64_t WriteCount{0};
+
+		/// @brief 调用内部写入器 WriteBytes 的次数，即实际产生的系统调用次数
+		std::uint64_t FlushCount{0};
+
+		/// @brief 交给内部写入器的总字节数
+		std::uint64_t ByteCount{0};
+
+		/// @brief 内部写入器未能写出全部字节的次数
+		std::uint64_t FailedFlushCount{0};
+
+		/// @brief 已被 WriteBytes 接受、但因写出失败而丢弃的字节数
+		std::uint64_t DroppedByteCount{0};
+	};
+
+	/// @brief 合并多次写入的写入器，减少小数据包产生的系统调用
+	///	@details
+	///		写入的字节先复制到缓冲区，满足以下任意条件时一次性交给内部写入器：
+	///		缓冲区中的字节数达到 FlushSize；缓冲区中最早的字节已等待 FlushDelay；调用 @c Flush 。
+	///		等待时间由内部线程负责，没有新的写入时也会按时写出。
+	///		使用两个缓冲区交替填充和写出，内部写入器写出时不持有填充缓冲区的锁，其他线程可以继续写入。
+	///		写出失败时丢弃这批字节，计入 @c BufferedWriterStatistics ，并由下一次 @c Flush 返回 false；
+	///		WriteBytes 只在自身的字节未被接受时返回 0，不会因为其他字节的写出失败而拒绝新的写入。
+	///	@tparam TCapacity 每个缓冲区的容量，超过此大小的单次写入将直接交给内部写入器
+	template <IsWriter TWriter, SizeType TCapacity = SizeType{1} << 16>
+	class BufferedWriter final {
+		ObjectUser<TWriter> Writer{};
+		SizeType FlushSize{4096};
+		std::chrono::microseconds FlushDelay{200};
+
+		/// @brief 保护正在填充的缓冲区、Size、Deadline 和 IsFailurePending
+		std::mutex Mutex{};
+		std::condition_variable_any Condition{};
+		std::array<std::array<ByteType, TCapacity>, 2> Buffers{};
+		SizeType FillingIndex{0};
+		SizeType Size{0};
+		std::chrono::steady_clock::time_point Deadline{};
+
+		/// @brief 写出失败，尚未由 @c Flush 报告给调用者
+		bool IsFailurePending{false};
+
+		/// @brief 保证字节按写入顺序写出，持有期间可以访问不在填充的缓冲区，必须先于 Mutex 获取
+		std::mutex FlushMutex{};
+
+		std::atomic<std::uint64_t> WriteCount{0};
+		std::atomic<std::uint64_t> FlushCount{0};
+		std::atomic<std::uint64_t> ByteCount{0};
+		std::atomic<std::uint64_t> FailedFlushCount{0};
+		std::atomic<std::uint64_t> DroppedByteCount{0};
+
+		/// @brief 按时写出缓冲区的线程，必须在所有成员之后构造
+		std::jthread Flusher{[this](const std::stop_token& token) { FlushOnDeadline(token); }};
+
+		struct Configurations {
+			struct ActorsType {
+				ObjectUser<TWriter>& Writer;
+			} Actors;
+
+			struct OptionsType {
+				SizeType& FlushSize;
+				std::chrono::microseconds& FlushDelay;
+			} Options;
+		};
+
+		/// @brief 将字节交给内部写入器，调用者必须持有 FlushMutex
+		///	@return 实际写出的字节数
+		[[nodiscard]] SizeType WriteThrough(const CByteSpan bytes) noexcept {
+			if (!Writer) {
+				FailedFlushCount.fetch_add(1, std::memory_order_relaxed);
+				return 0;
+			}
+			const auto written = Writer->WriteBytes(bytes);
+			FlushCount.fetch_add(1, std::memory_order_relaxed);
+			ByteCount.fetch_add(written, std::memory_order_relaxed);
+			if (written != bytes.size()) FailedFlushCount.fetch_add(1, std::memory_order_relaxed);
+			return written;
+		}
+
+		/// @brief 交换缓冲区，在不持有 Mutex 的情况下写出原来正在填充的缓冲区，调用者必须持有 FlushMutex
+		///	@return 是否全部写出
+		[[nodiscard]] bool FlushHeld() noexcept {
+			SizeType index;
+			SizeType size;
+			{
+				std::lock_guard lock{Mutex};
+				if (Size == 0) return true;
+				index = FillingIndex;
+				size = Size;
+				FillingIndex ^= 1;
+				Size = 0;
+			}
+
+			const auto written = WriteThrough(CByteSpan{Buffers[index].data(), size});
+			if (written >= size) return true;
+			DroppedByteCount.fetch_add(size - written, std::memory_order_relaxed);
+			std::lock_guard lock{Mutex};
+			IsFailurePending = true;
+			return false;
+		}
+
+		/// @brief 获取 FlushMutex 后调用 @c FlushHeld
+		bool FlushBuffer() noexcept {
+			std::lock_guard flush_lock{FlushMutex};
+			return FlushHeld();
+		}
+
+		/// @brief 将字节复制到正在填充的缓冲区
+		///	@param isFlushDue 复制后缓冲区中的字节数是否达到 FlushSize
+		///	@return 剩余空间不足时不复制，返回 false
+		[[nodiscard]] bool Append(const CByteSpan bytes, bool& isFlushDue) noexcept {
+			std::lock_guard lock{Mutex};
+			if (bytes.size() > TCapacity - Size) return false;
+			if (Size == 0) {
+				Deadline = std::chrono::steady_clock::now() + FlushDelay;
+				Condition.notify_one();
+			}
+			std::ranges::copy(bytes, Buffers[FillingIndex].begin() + static_cast<std::ptrdiff_t>(Size));
+			Size += bytes.size();
+			isFlushDue = Size >= FlushSize;
+			return true;
+		}
+
+		void FlushOnDeadline(const std::stop_token& token) noexcept {
+			std::unique_lock lock{Mutex};
+			while (!token.stop_requested()) {
+				if (Size == 0) {
+					Condition.wait(lock, token, [this] { return Size != 0; });
+					continue;
+				}
+				const auto deadline = Deadline;
+				Condition.wait_until(lock, token, deadline, [this, deadline] { return Size == 0 || Deadline != deadline; });
+				if (Size == 0 || std::chrono::steady_clock::now() < Deadline) continue;
+
+				lock.unlock();
+				(void)FlushBuffer();
+				lock.lock();
+			}
+		}
+
+	public:
+		using WriterType = TWriter;
+		static constexpr SizeType Capacity = TCapacity;
+
+		BufferedWriter() noexcept = default;
+
+		~BufferedWriter() noexcept {
+			Flusher.request_stop();
+			Flusher.join();
+			(void)Flush();
+		}
+
+		BufferedWriter(const BufferedWriter&) = delete;
+		BufferedWriter& operator=(const BufferedWriter&) = delete;
+
+		[[nodiscard]] Configurations Configure() noexcept {
+			return {
+				.Actors = {Writer},
+				.Options = {FlushSize, FlushDelay}
+			};
+		}
+
+		[[nodiscard]] bool IsFunctional() const noexcept { return ValidateAll(Writer); }
+
+		/// @brief 将字节加入缓冲区，必要时写出
+		///	@return 字节被接受时返回 buffer.size()；超过缓冲区容量的字节直接写出，失败时返回 0
+		[[nodiscard]] SizeType WriteBytes(const CByteSpan buffer) noexcept {
+			WriteCount.fetch_add(1, std::memory_order_relaxed);
+
+			if (buffer.size() >= TCapacity) {
+				std::lock_guard flush_lock{FlushMutex};
+				(void)FlushHeld(); // 先写出之前的字节以保持顺序，失败已记录
+				return WriteThrough(buffer) == buffer.size() ? buffer.size() : 0;
+			}
+
+			bool is_flush_due{false};
+			while (!Append(buffer, is_flush_due)) (void)FlushBuffer();
+			if (is_flush_due) (void)FlushBuffer();
+			return buffer.size();
+		}
+
+		/// @brief 立即写出缓冲区中的所有字节
+		///	@return 是否全部写出，且上一次调用 Flush 之后没有写出失败
+		[[nodiscard]] bool Flush() noexcept {
+			std::lock_guard flush_lock{FlushMutex};
+			const auto successful = FlushHeld();
+			std::lock_guard lock{Mutex};
+			const auto is_failure_pending = std::exchange(IsFailurePending, false);
+			return successful && !is_failure_pending;
+		}
+
+		/// @brief 获取统计数据，不需要加锁
+		[[nodiscard]] BufferedWriterStatistics GetStatistics() const noexcept {
+			return {
+				.WriteCount = WriteCount.load(std::memory_order_relaxed),
+				.FlushCount = FlushCount.load(std::memory_order_relaxed),
+				.ByteCount = ByteCount.load(std::memory_order_relaxed),
+				.FailedFlushCount = FailedFlushCount.load(std::memory_order_relaxed),
+				.DroppedByteCount = DroppedByteCount.load(std::memory_order_relaxed)
+			};
+		}
+	};
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "ByteTypes.hpp"
+
+namespace Cango :: inline ByteCommunication :: inline Core {
+	/// @brief 从低位到高位依次取出掩码中的置位，交给 handler 处理
+	///	@param base 掩码第 0 位对应的字节下标
+	///	@return handler 返回 true 时停止并返回对应下标，否则返回 @c SIZE_MAX
+	template <typename TMask, typename THandler>
+	[[nodiscard]] SizeType ForEachMaskBit(TMask mask, const SizeType base, THandler& handler) noexcept {
+		while (mask != 0) {
+			const auto index = base + static_cast<SizeType>(std::countr_zero(mask));
+			if (handler(index)) return index;
+			mask &= mask - 1;
+		}
+		return SIZE_MAX;
+	}
+
+	/// @brief 查找区间中所有等于目标字节的位置，按从前到后的顺序交给 handler 检查
+	///	@details
+	///		编译时启用 AVX2 或 SSE2 时，每次比较 32 或 16 个字节得到候选位置的位掩码，再逐位取出；
+	///		剩余不足一块的字节以及不支持 SIMD 的平台，退化为逐字节比较。
+	///	@param handler 形如 bool(SizeType index) 的可调用对象，返回 true 表示已找到需要的位置，停止查找
+	///	@return 使 handler 返回 true 的位置，如果没有则返回 span.size()
+	template <typename THandler>
+	[[nodiscard]] SizeType FindEachByte(const CByteSpan span, const ByteType target, THandler&& handler) noexcept {
+		const auto* data = span.data();
+		const auto size = span.size();
+		SizeType offset{0};
+
+#if defined(__AVX2__)
+		const auto target32 = _mm256_set1_epi8(static_cast<char>(target));
+		for (; offset + 32 <= size; offset += 32) {
+			const auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + offset));
+			const auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, target32)));
+			if (const auto found = ForEachMaskBit(mask, offset, handler); found != SIZE_MAX) return found;
+		}
+#endif
+
+#if defined(__SSE2__)
+		const auto target16 = _mm_set1_epi8(static_cast<char>(target));
+		for (; offset + 16 <= size; offset += 16) {
+			const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset));
+			const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, target16)));
+			if (const auto found = ForEachMaskBit(mask, offset, handler); found != SIZE_MAX) return found;
+		}
+#endif
+
+		for (; offset < size; ++offset)
+			if (data[offset] == target && handler(offset)) return offset;
+		return size;
+	}
+}
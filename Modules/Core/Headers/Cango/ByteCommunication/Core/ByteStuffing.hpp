@@ -0,0 +1,275 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+
+#include "RingFramer.hpp"
+
+namespace Cango :: inline ByteCommunication :: inline Core {
+	/// @brief 字节填充编解码器的概念
+	///	@details
+	///		编码后的数据包以 Delimiter 结尾，且数据包内部不会出现 Delimiter，因此数据包边界没有歧义。
+	///		Encode 输出包含结尾的 Delimiter，Decode 的输入不包含 Delimiter；
+	///		MaxEncodedSize 为给定长度的数据编码后(包含 Delimiter)的最大长度。
+	template <typename TObject>
+	concept IsByteStuffingCodec = requires(CByteSpan input, ByteSpan output, SizeType& size) {
+		{ TObject::Delimiter } -> std::convertible_to<ByteType>;
+		{ TObject::MaxEncodedSize(SizeType{}) } -> std::same_as<SizeType>;
+		{ TObject::Encode(input, output) } -> std::same_as<SizeType>;
+		{ TObject::Decode(input, output, size) } -> std::same_as<bool>;
+	};
+
+	/// @brief COBS(Consistent Overhead Byte Stuffing) 编解码器，以 0 作为数据包分隔符
+	///	@details 每 254 字节最多增加 1 字节开销
+	struct CobsCodec {
+		static constexpr ByteType Delimiter = 0;
+
+		[[nodiscard]] static constexpr SizeType MaxEncodedSize(const SizeType size) noexcept {
+			return size + size / 254 + 2;
+		}
+
+		/// @brief 编码数据并在末尾添加分隔符
+		///	@param output 大小至少为 @c MaxEncodedSize(input.size())
+		///	@return 编码后的字节数，如果输出区间不足则返回 0
+		static SizeType Encode(const CByteSpan input, const ByteSpan output) noexcept {
+			if (output.size() < MaxEncodedSize(input.size())) return 0;
+
+			SizeType code_index{0};
+			SizeType index{1};
+			ByteType code{1};
+			for (const auto byte : input) {
+				if (byte != 0) {
+					output[index++] = byte;
+					if (++code != 0xFF) continue;
+				}
+				output[code_index] = code;
+				code_index = index++;
+				code = 1;
+			}
+			output[code_index] = code;
+			output[index++] = Delimiter;
+			return index;
+		}
+
+		/// @brief 解码不含分隔符的数据
+		///	@param size 解码后的字节数
+		///	@return 数据是否合法，且输出区间足够
+		static bool Decode(const CByteSpan input, const ByteSpan output, SizeType& size) noexcept {
+			SizeType index{0};
+			size = 0;
+			while (index < input.size()) {
+				const SizeType code = input[index++];
+				if (code == 0) return false;
+
+				const auto count = code - 1;
+				if (index + count > input.size() || size + count > output.size()) return false;
+				std::copy_n(input.data() + index, count, output.data() + size);
+				index += count;
+				size += count;
+
+				if (code == 0xFF || index == input.size()) continue;
+				if (size == output.size()) return false;
+				output[size++] = 0;
+			}
+			return true;
+		}
+	};
+
+	/// @brief SLIP(RFC 1055) 编解码器，以 0xC0 作为数据包分隔符
+	///	@details 数据中的 0xC0 和 0xDB 被转义为两个字节，最坏情况下编码后长度翻倍
+	struct SlipCodec {
+		static constexpr ByteType Delimiter = 0xC0;
+		static constexpr ByteType Escape = 0xDB;
+		static constexpr ByteType EscapedDelimiter = 0xDC;
+		static constexpr ByteType EscapedEscape = 0xDD;
+
+		[[nodiscard]] static constexpr SizeType MaxEncodedSize(const SizeType size) noexcept { return size * 2 + 1; }
+
+		/// @brief 编码数据并在末尾添加分隔符
+		///	@param output 大小至少为 @c MaxEncodedSize(input.size())
+		///	@return 编码后的字节数，如果输出区间不足则返回 0
+		static SizeType Encode(const CByteSpan input, const ByteSpan output) noexcept {
+			if (output.size() < MaxEncodedSize(input.size())) return 0;
+
+			SizeType index{0};
+			for (const auto byte : input) {
+				if (byte == Delimiter) {
+					output[index++] = Escape;
+					output[index++] = EscapedDelimiter;
+				}
+				else if (byte == Escape) {
+					output[index++] = Escape;
+					output[index++] = EscapedEscape;
+				}
+				else output[index++] = byte;
+			}
+			output[index++] = Delimiter;
+			return index;
+		}
+
+		/// @brief 解码不含分隔符的数据
+		///	@param size 解码后的字节数
+		///	@return 数据是否合法，且输出区间足够
+		static bool Decode(const CByteSpan input, const ByteSpan output, SizeType& size) noexcept {
+			size = 0;
+			for (SizeType index = 0; index < input.size(); ++index) {
+				if (size == output.size()) return false;
+				auto byte = input[index];
+				if (byte == Escape) {
+					if (++index == input.size()) return false;
+					byte = input[index];
+					if (byte == EscapedDelimiter) byte = Delimiter;
+					else if (byte == EscapedEscape) byte = Escape;
+					else return false;
+				}
+				output[size++] = byte;
+			}
+			return true;
+		}
+	};
+
+	/// @brief 基于环形缓冲区和字节填充的分帧器，以分隔符确定数据包边界
+	///	@details
+	///		使用 @c FindEachByte 查找分隔符，两个分隔符之间的字节解码后交给检验器。
+	///		数据损坏时只会丢失当前数据包，下一个分隔符之后立即恢复同步，不需要重新扫描。
+	///		已经扫描过的字节会被记录，下一次写入后只扫描新的字节。
+	///	@tparam TCodec 编解码器，见 @c IsByteStuffingCodec
+	///	@tparam TVerifier 用于检验解码后的数据包是否符合要求
+	///	@tparam TMaxFrameSize 解码后的数据包最大长度，编码后超过对应长度的数据将被丢弃
+	///	@tparam TCapacity 缓冲区容量，必须是 2 的幂，且大于编码后的数据包最大长度
+	template <
+		IsByteStuffingCodec TCodec,
+		IsVerifier TVerifier,
+		SizeType TMaxFrameSize,
+		SizeType TCapacity = SizeType{1} << 17>
+	requires (TMaxFrameSize > 0 && std::has_single_bit(TCapacity) && TCodec::MaxEncodedSize(TMaxFrameSize) < TCapacity)
+	class DelimitedRingFramer final {
+		/// @brief 不含分隔符的编码数据最大长度
+		static constexpr SizeType MaxEncodedSize = TCodec::MaxEncodedSize(TMaxFrameSize) - 1;
+
+		RingByteBuffer<TCapacity, MaxEncodedSize> Buffer{};
+		std::array<ByteType, TMaxFrameSize> Decoded{};
+
+		/// @brief 从读取位置开始已经确认不含分隔符的字节数
+		SizeType ScannedSize{0};
+
+		/// @brief 当前数据包过长，在下一个分隔符之前的字节都应丢弃
+		bool IsSkipping{false};
+
+		/// @brief 上一个数据包之后丢弃过字节，输出下一个数据包时记为一次重新同步
+		bool IsResyncPending{false};
+
+		[[nodiscard]] bool FindDelimiter(SizeType& position) noexcept {
+			while (ScannedSize < Buffer.Size()) {
+				const auto chunk = Buffer.Peek(ScannedSize, Buffer.ContiguousSize(ScannedSize));
+				const auto offset = FindEachByte(chunk, TCodec::Delimiter, [](SizeType) { return true; });
+				if (offset != chunk.size()) {
+					position = ScannedSize + offset;
+					return true;
+				}
+				ScannedSize += chunk.size();
+			}
+			return false;
+		}
+
+		/// @brief 取出下一个通过检验的数据包，不记录输出的数据包
+		[[nodiscard]] bool FindFrame(CByteSpan& frame) noexcept {
+			SizeType position;
+			while (FindDelimiter(position)) {
+				const auto is_skipped = IsSkipping || position == 0 || position > MaxEncodedSize;
+				SizeType size{0};
+				const auto successful = !is_skipped && TCodec::Decode(Buffer.Peek(0, position), Decoded, size);
+				Buffer.Discard(position + 1);
+				ScannedSize = 0;
+				IsSkipping = false;
+
+				frame = CByteSpan{Decoded.data(), size};
+				if (successful && Verifier.Verify(frame)) return true;
+				if (successful && Counters) Counters->VerifyRejects.Add();
+				if (position != 0) IsResyncPending = true; // 连续的分隔符之间是空数据包，不算丢弃
+			}
+
+			if (Buffer.Size() > MaxEncodedSize) {
+				Buffer.Discard(Buffer.Size());
+				ScannedSize = 0;
+				IsSkipping = true;
+				IsResyncPending = true;
+			}
+			return false;
+		}
+
+		void CountFrame() noexcept {
+			if (Counters) {
+				Counters->FramesEmitted.Add();
+				if (IsResyncPending) Counters->Resyncs.Add();
+			}
+			IsResyncPending = false;
+		}
+
+	public:
+		using CodecType = TCodec;
+		using VerifierType = TVerifier;
+		static constexpr SizeType MaxFrameSize = TMaxFrameSize;
+		static constexpr SizeType Capacity = TCapacity;
+
+		TVerifier Verifier{};
+
+		/// @brief 记录输出的数据包、重新同步和检验失败的次数，为空时不记录
+		ObjectUser<ConnectionCounters> Counters{};
+
+		/// @brief 缓冲区中尚未取出的字节数
+		[[nodiscard]] SizeType Size() const noexcept { return Buffer.Size(); }
+
+		/// @brief 缓冲区剩余可写入的字节数
+		[[nodiscard]] SizeType FreeSize() const noexcept { return Buffer.FreeSize(); }
+
+		/// @copydoc RingByteBuffer::WritableSpan
+		[[nodiscard]] ByteSpan WritableSpan() noexcept { return Buffer.WritableSpan(); }
+
+		/// @copydoc RingByteBuffer::Commit
+		void Commit(const SizeType count) noexcept { Buffer.Commit(count); }
+
+		/// @copydoc RingByteBuffer::Write
+		SizeType Write(const CByteSpan bytes) noexcept { return Buffer.Write(bytes); }
+
+		/// @brief 下一个数据包解码后长度为 frameSize 时，至少还需要写入多少字节才可能完整
+		///	@details
+		///		编码不会缩短数据，加上分隔符后数据包至少占 frameSize + 1 个字节；
+		///		@c Next 返回 false 后缓冲区中只剩尚未完整的数据包，按此长度阻塞读取不会读到下一个数据包的字节
+		[[nodiscard]] SizeType MissingSize(const SizeType frameSize) const noexcept {
+			const auto size = Buffer.Size();
+			return size < frameSize + 1 ? frameSize + 1 - size : 1;
+		}
+
+		/// @brief 取出下一个完整的数据包，过长、解码失败和未通过检验的数据包将被丢弃
+		///	@param frame 指向内部解码缓冲区的数据包，在下一次调用 @c Next 前有效
+		///	@return 是否找到数据包
+		[[nodiscard]] bool Next(CByteSpan& frame) noexcept {
+			if (!FindFrame(frame)) return false;
+			CountFrame();
+			return true;
+		}
+
+		/// @brief 取出下一个长度恰好为目标区间大小的数据包，并复制到目标位置，其他长度的数据包将被丢弃
+		[[nodiscard]] bool Examine(const ByteSpan destination) noexcept {
+			CByteSpan frame;
+			while (FindFrame(frame)) {
+				if (frame.size() != destination.size()) {
+					IsResyncPending = true;
+					continue;
+				}
+				std::ranges::copy(frame, destination.begin());
+				CountFrame();
+				return true;
+			}
+			return false;
+		}
+	};
+
+	template <IsVerifier TVerifier, SizeType TMaxFrameSize, SizeType TCapacity = SizeType{1} << 17>
+	using CobsRingFramer = DelimitedRingFramer<CobsCodec, TVerifier, TMaxFrameSize, TCapacity>;
+
+	template <IsVerifier TVerifier, SizeType TMaxFrameSize, SizeType TCapacity = SizeType{1} << 17>
+	using SlipRingFramer = DelimitedRingFramer<SlipCodec, TVerifier, TMaxFrameSize, TCapacity>;
+}
@@ -1,10 +1,14 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <bit>
+#include <concepts>
 #include <cstddef>
 #include <cstdint>
 #include <format>
 #include <span>
+#include <string_view>
 
 namespace Cango :: inline ByteCommunication :: inline Core {
 	using SizeType = std::size_t;
@@ -17,12 +21,70 @@ namespace Cango :: inline ByteCommunication :: inline Core {
 
 	template<SizeType TSize>
 	using ByteArray = std::array<ByteType, TSize>;
+
+	/// @brief 按字节序从区间读取整数
+	template <std::unsigned_integral TValue, std::endian TByteOrder>
+	[[nodiscard]] constexpr TValue LoadInteger(const CByteSpan span) noexcept {
+		TValue value{0};
+		for (SizeType index = 0; index < sizeof(TValue); ++index) {
+			const auto shift = TByteOrder == std::endian::little ? index * 8 : (sizeof(TValue) - 1 - index) * 8;
+			value = static_cast<TValue>(value | (static_cast<TValue>(span[index]) << shift));
+		}
+		return value;
+	}
+
+	/// @brief 按字节序将整数写入区间
+	template <std::unsigned_integral TValue, std::endian TByteOrder>
+	constexpr void StoreInteger(const ByteSpan span, const TValue value) noexcept {
+		for (SizeType index = 0; index < sizeof(TValue); ++index) {
+			const auto shift = TByteOrder == std::endian::little ? index * 8 : (sizeof(TValue) - 1 - index) * 8;
+			span[index] = static_cast<ByteType>(value >> shift);
+		}
+	}
+
+	/// @brief 将字节区间视作消息的只读引用，不复制数据
+	///	@note 仅适用于按 1 字节对齐的消息类型(如 @c TypedMessage )，区间大小不能小于消息大小
+	template<typename TMessage>
+	[[nodiscard]] const TMessage& ViewAs(const CByteSpan span) noexcept {
+		static_assert(alignof(TMessage) == 1, "ViewAs: the view may start at any byte of the buffer, TMessage must be 1-byte aligned");
+		return *reinterpret_cast<const TMessage*>(span.data());
+	}
+}
+
+namespace Cango :: inline ByteCommunication :: inline Core :: Details {
+	/// @brief 每个字节对应的两个十六进制字符，共 512 字节
+	template <bool TIsUpper>
+	inline constexpr auto HexDigitPairs = [] {
+		constexpr auto digits = TIsUpper ? "0123456789ABCDEF" : "0123456789abcdef";
+		std::array<char, 512> pairs{};
+		for (SizeType index = 0; index < 256; ++index) {
+			pairs[index * 2] = digits[index >> 4];
+			pairs[index * 2 + 1] = digits[index & 0xF];
+		}
+		return pairs;
+	}();
 }
 
 /// @brief 实现利用字节类型的格式标准实现只读字符区间的格式化
+///	@details
+///		格式说明符为 {:02X} 或 {:02x} 时，查表将每个字节转换为两个字符，先写入栈上的缓冲区再整块输出；
+///		其他格式说明符逐字节交给 @c std::formatter<Cango::ByteType> 处理。
 template<>
 struct std::formatter<Cango::CByteSpan> : std::formatter<Cango::ByteType> {
+	/// @brief 快速路径使用的查找表，为空时使用逐字节格式化
+	const char* HexDigitPairs{nullptr};
+
+	constexpr auto parse(std::format_parse_context& ctx) {
+		const std::string_view spec{ctx.begin(), std::find(ctx.begin(), ctx.end(), '}')};
+		if (spec == "02X") HexDigitPairs = Cango::Details::HexDigitPairs<true>.data();
+		else if (spec == "02x") HexDigitPairs = Cango::Details::HexDigitPairs<false>.data();
+		else HexDigitPairs = nullptr;
+		return std::formatter<Cango::ByteType>::parse(ctx);
+	}
+
 	auto format(const Cango::CByteSpan& span, std::format_context& ctx) const {
+		if (HexDigitPairs != nullptr) return FormatHex(span, ctx);
+
 		using byte_formatter = std::formatter<Cango::ByteType>; // 此格式化器将使用当前上下文，包含用户传递的格式说明符
 
 		if (span.empty()) return ctx.out();
@@ -35,4 +97,27 @@ struct std::formatter<Cango::CByteSpan> : std::formatter<Cango::ByteType> {
 		}
 		return byte_formatter::format(span.back(), ctx);
 	}
+
+private:
+	std::format_context::iterator FormatHex(const Cango::CByteSpan& span, std::format_context& ctx) const {
+		constexpr Cango::SizeType chunk_size = 128; // 每块字节数，对应 384 个字符
+		std::array<char, chunk_size * 3> buffer; // NOLINT(*-pro-type-member-init)
+
+		auto it = ctx.out();
+		for (Cango::SizeType begin = 0; begin < span.size(); begin += chunk_size) {
+			const auto end = std::min(begin + chunk_size, span.size());
+			auto* output = buffer.data();
+			for (auto index = begin; index < end; ++index) {
+				const auto* pair = HexDigitPairs + span[index] * 2;
+				output[0] = pair[0];
+				output[1] = pair[1];
+				output[2] = ' ';
+				output += 3;
+			}
+			// 最后一个字节之后没有空格
+			if (end == span.size()) --output;
+			it = std::copy(buffer.data(), output, it);
+		}
+		return it;
+	}
 };
@@ -0,0 +1,357 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <Cango/CommonUtils/ObjectOwnership.hpp>
+
+#include "RWer.hpp"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Cango :: inline ByteCommunication :: inline Core {
+	/// @brief 记录中字节的方向
+	///	@details 值为 0 的记录头表示文件结束，预分配但未写入的区域均为 0
+	enum class CaptureDirection : ByteType {
+		Read = 1,
+		Write = 2
+	};
+
+	/// @brief 记录文件的格式
+	///	@details
+	///		文件头 16 字节：魔数 "CGCP"、版本(u32)、开始记录时的系统时间(u64，纳秒)。
+	///		之后是连续的记录，每条记录为 16 字节记录头加数据：
+	///		距开始记录的时间(u64，纳秒)、数据长度(u32)、方向(u8)、3 字节保留。
+	///		所有整数均为小端序。
+	struct CaptureFormat {
+		static constexpr ByteArray<4> Magic{'C', 'G', 'C', 'P'};
+		static constexpr std::uint32_t Version = 1;
+		static constexpr SizeType FileHeaderSize = 16;
+		static constexpr SizeType RecordHeaderSize = 16;
+
+		/// @brief 解析后的记录
+		struct Record {
+			std::chrono::nanoseconds Time{};
+			CaptureDirection Direction{};
+			CByteSpan Bytes{};
+		};
+	};
+
+	/// @brief 将读写的字节追加到记录文件
+	///	@details
+	///		记录先复制到内存中的批次，批次达到 BatchSize 时一次写入文件。
+	///		POSIX 平台上可以预分配文件空间，析构时截断到实际写入的大小。
+	///		多个线程可以同时追加记录。
+	class CaptureWriter final {
+		std::FILE* File{nullptr};
+		SizeType BatchSize;
+		SizeType PreallocatedSize{0};
+		SizeType WrittenSize{0};
+		std::chrono::steady_clock::time_point StartTime{std::chrono::steady_clock::now()};
+
+		std::mutex Mutex{};
+		std::vector<ByteType> Batch{};
+
+		/// @brief 写出批次，调用者必须持有 Mutex
+		bool FlushLocked() noexcept {
+			if (Batch.empty()) return true;
+			const auto written = std::fwrite(Batch.data(), 1, Batch.size(), File);
+			WrittenSize += written;
+			const auto successful = written == Batch.size();
+			Batch.clear();
+			return successful;
+		}
+
+	public:
+		/// @brief 创建记录文件，覆盖已有的文件
+		///	@param path 文件路径
+		///	@param preallocatedSize 预分配的文件大小，为 0 时不预分配
+		///	@param batchSize 每次写入文件的字节数
+		explicit CaptureWriter(
+			const std::filesystem::path& path,
+			const SizeType preallocatedSize = 0,
+			const SizeType batchSize = SizeType{1} << 16) noexcept :
+			File(std::fopen(path.string().c_str(), "wb")),
+			BatchSize(batchSize) {
+			if (File == nullptr) return;
+			std::setvbuf(File, nullptr, _IONBF, 0);
+			Batch.reserve(BatchSize + CaptureFormat::RecordHeaderSize);
+
+#ifndef _WIN32
+			if (preallocatedSize != 0 && ::posix_fallocate(::fileno(File), 0, static_cast<off_t>(preallocatedSize)) == 0)
+				PreallocatedSize = preallocatedSize;
+#else
+			(void)preallocatedSize;
+#endif
+
+			const auto system_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::system_clock::now().time_since_epoch());
+			ByteArray<CaptureFormat::FileHeaderSize> header{};
+			std::ranges::copy(CaptureFormat::Magic, header.begin());
+			StoreInteger<std::uint32_t, std::endian::little>(ByteSpan{header}.subspan(4), CaptureFormat::Version);
+			StoreInteger<std::uint64_t, std::endian::little>(
+				ByteSpan{header}.subspan(8),
+				static_cast<std::uint64_t>(system_time.count()));
+			Batch.assign(header.begin(), header.end());
+		}
+
+		~CaptureWriter() noexcept {
+			if (File == nullptr) return;
+			(void)Flush();
+#ifndef _WIN32
+			if (PreallocatedSize > WrittenSize) (void)::ftruncate(::fileno(File), static_cast<off_t>(WrittenSize));
+#endif
+			std::fclose(File);
+		}
+
+		CaptureWriter(const CaptureWriter&) = delete;
+		CaptureWriter& operator=(const CaptureWriter&) = delete;
+
+		[[nodiscard]] bool IsOpen() const noexcept { return File != nullptr; }
+
+		/// @brief 追加一条记录，批次满时写入文件
+		///	@return 文件是否可用且写入成功
+		bool Append(const CaptureDirection direction, const CByteSpan bytes) noexcept {
+			if (File == nullptr) return false;
+			const auto time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now() - StartTime);
+			ByteArray<CaptureFormat::RecordHeaderSize> header{};
+			StoreInteger<std::uint64_t, std::endian::little>(ByteSpan{header}, static_cast<std::uint64_t>(time.count()));
+			StoreInteger<std::uint32_t, std::endian::little>(
+				ByteSpan{header}.subspan(8),
+				static_cast<std::uint32_t>(bytes.size()));
+			header[12] = static_cast<ByteType>(direction);
+
+			std::lock_guard lock{Mutex};
+			Batch.insert(Batch.end(), header.begin(), header.end());
+			Batch.insert(Batch.end(), bytes.begin(), bytes.end());
+			return Batch.size() < BatchSize || FlushLocked();
+		}
+
+		/// @brief 将批次中的记录写入文件
+		bool Flush() noexcept {
+			if (File == nullptr) return false;
+			std::lock_guard lock{Mutex};
+			return FlushLocked();
+		}
+	};
+
+	/// @brief 记录所有读写字节的 @c RWer 装饰器
+	///	@details 只记录实际读到或写出的字节，未设置 Capture 时与内部读写器相同
+	template <IsRWer TRWer>
+	class RecordingRWer final {
+		ObjectUser<TRWer> RWer{};
+		ObjectUser<CaptureWriter> Capture{};
+
+		struct Configurations {
+			struct ActorsType {
+				ObjectUser<TRWer>& RWer;
+				ObjectUser<CaptureWriter>& Capture;
+			} Actors;
+		};
+
+		SizeType Record(const CaptureDirection direction, const CByteSpan buffer, const SizeType bytes) noexcept {
+			if (Capture && bytes != 0) (void)Capture->Append(direction, buffer.first(bytes));
+			return bytes;
+		}
+
+	public:
+		using RWerType = TRWer;
+
+		[[nodiscard]] Configurations Configure() noexcept { return {.Actors = {RWer, Capture}}; }
+
+		[[nodiscard]] bool IsFunctional() const noexcept { return ValidateAll(RWer); }
+
+		[[nodiscard]] SizeType ReadBytes(const ByteSpan buffer) noexcept {
+			return Record(CaptureDirection::Read, buffer, RWer->ReadBytes(buffer));
+		}
+
+		[[nodiscard]] SizeType ReadSome(const ByteSpan buffer, const TimeoutType timeout) noexcept
+		requires IsPartialReader<TRWer> {
+			return Record(CaptureDirection::Read, buffer, RWer->ReadSome(buffer, timeout));
+		}
+
+		[[nodiscard]] SizeType WriteBytes(const CByteSpan buffer) noexcept {
+			return Record(CaptureDirection::Write, buffer, RWer->WriteBytes(buffer));
+		}
+	};
+}
+
+namespace Cango :: inline ByteCommunication :: inline Core :: Details {
+	/// @brief 只读映射到内存的文件，不支持 mmap 的平台上读入内存
+	class MappedFile final {
+		const ByteType* Data{nullptr};
+		SizeType Size{0};
+#ifndef _WIN32
+		void* Mapping{nullptr};
+#else
+		std::vector<ByteType> Content{};
+#endif
+
+	public:
+		explicit MappedFile(const std::filesystem::path& path) noexcept {
+#ifndef _WIN32
+			const auto descriptor = ::open(path.c_str(), O_RDONLY);
+			if (descriptor < 0) return;
+			struct stat status{};
+			if (::fstat(descriptor, &status) == 0 && status.st_size > 0) {
+				const auto size = static_cast<SizeType>(status.st_size);
+				if (const auto mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0); mapping != MAP_FAILED) {
+					(void)::madvise(mapping, size, MADV_SEQUENTIAL);
+					Mapping = mapping;
+					Data = static_cast<const ByteType*>(mapping);
+					Size = size;
+				}
+			}
+			::close(descriptor);
+#else
+			std::ifstream stream{path, std::ios::binary};
+			Content.assign(std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{});
+			Data = Content.data();
+			Size = Content.size();
+#endif
+		}
+
+		~MappedFile() noexcept {
+#ifndef _WIN32
+			if (Mapping != nullptr) ::munmap(Mapping, Size);
+#endif
+		}
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		[[nodiscard]] CByteSpan GetBytes() const noexcept { return {Data, Size}; }
+	};
+}
+
+namespace Cango :: inline ByteCommunication :: inline Core {
+	/// @brief 从记录文件中回放某一方向字节的 @c Reader
+	///	@details
+	///		记录文件映射到内存后按记录顺序输出字节，ReadBytes 可以跨越多条记录。
+	///		IsRealTime 为 true 时，每条记录在与开始回放的时间差达到记录时间后才输出，
+	///		否则尽快输出，可以用真实流量测量吞吐量。
+	///		所有记录读完后返回 0。
+	class ReplayReader final {
+		Details::MappedFile File;
+		CByteSpan Remaining{};
+		CByteSpan Current{};
+		std::chrono::nanoseconds CurrentTime{};
+		std::chrono::nanoseconds FirstTime{-1};
+		std::chrono::steady_clock::time_point StartTime{};
+
+		CaptureDirection Direction{CaptureDirection::Read};
+		bool IsRealTime{false};
+
+		struct Configurations {
+			struct OptionsType {
+				CaptureDirection& Direction;
+				bool& IsRealTime;
+			} Options;
+		};
+
+		/// @brief 解析下一条记录，文件结束或记录不完整时返回 false
+		[[nodiscard]] bool ParseRecord(CaptureFormat::Record& record) noexcept {
+			if (Remaining.size() < CaptureFormat::RecordHeaderSize) return false;
+			const auto time = LoadInteger<std::uint64_t, std::endian::little>(Remaining);
+			const auto size = LoadInteger<std::uint32_t, std::endian::little>(Remaining.subspan(8));
+			const auto direction = Remaining[12];
+			if (direction == 0 || Remaining.size() - CaptureFormat::RecordHeaderSize < size) return false;
+
+			record.Time = std::chrono::nanoseconds{static_cast<std::int64_t>(time)};
+			record.Direction = static_cast<CaptureDirection>(direction);
+			record.Bytes = Remaining.subspan(CaptureFormat::RecordHeaderSize, size);
+			Remaining = Remaining.subspan(CaptureFormat::RecordHeaderSize + size);
+			return true;
+		}
+
+		/// @brief 当前记录读完时取出下一条方向相符的记录
+		[[nodiscard]] bool PrepareCurrent() noexcept {
+			CaptureFormat::Record record{};
+			while (Current.empty()) {
+				if (!ParseRecord(record)) return false;
+				if (record.Direction != Direction) continue;
+				if (FirstTime.count() < 0) {
+					FirstTime = record.Time;
+					StartTime = std::chrono::steady_clock::now();
+				}
+				Current = record.Bytes;
+				CurrentTime = record.Time - FirstTime;
+			}
+			return true;
+		}
+
+		/// @brief 实时回放时等待当前记录到期，超过 deadline 时返回 false
+		[[nodiscard]] bool WaitCurrent(const std::chrono::steady_clock::time_point deadline) const noexcept {
+			if (!IsRealTime) return true;
+			const auto due = StartTime + std::chrono::duration_cast<std::chrono::steady_clock::duration>(CurrentTime);
+			if (due > deadline) {
+				std::this_thread::sleep_until(deadline);
+				return false;
+			}
+			std::this_thread::sleep_until(due);
+			return true;
+		}
+
+		SizeType TakeCurrent(const ByteSpan buffer) noexcept {
+			const auto count = std::min(buffer.size(), Current.size());
+			std::copy_n(Current.data(), count, buffer.data());
+			Current = Current.subspan(count);
+			return count;
+		}
+
+	public:
+		explicit ReplayReader(const std::filesystem::path& path) noexcept : File(path) { Rewind(); }
+
+		[[nodiscard]] Configurations Configure() noexcept { return {.Options = {Direction, IsRealTime}}; }
+
+		/// @brief 文件头是否有效
+		[[nodiscard]] bool IsFunctional() const noexcept {
+			const auto bytes = File.GetBytes();
+			return bytes.size() >= CaptureFormat::FileHeaderSize &&
+				std::ranges::equal(bytes.first(4), CaptureFormat::Magic) &&
+				LoadInteger<std::uint32_t, std::endian::little>(bytes.subspan(4)) == CaptureFormat::Version;
+		}
+
+		/// @brief 回到第一条记录，重新开始计时
+		void Rewind() noexcept {
+			Remaining = IsFunctional() ? File.GetBytes().subspan(CaptureFormat::FileHeaderSize) : CByteSpan{};
+			Current = {};
+			FirstTime = std::chrono::nanoseconds{-1};
+		}
+
+		/// @brief 读取字节，直到缓冲区填满或所有记录读完
+		[[nodiscard]] SizeType ReadBytes(const ByteSpan buffer) noexcept {
+			SizeType read = 0;
+			while (read < buffer.size() && PrepareCurrent()) {
+				(void)WaitCurrent(std::chrono::steady_clock::time_point::max());
+				read += TakeCurrent(buffer.subspan(read));
+			}
+			return read;
+		}
+
+		/// @brief 读取当前记录中剩余的字节，实时回放时最多等待 timeout
+		[[nodiscard]] SizeType ReadSome(const ByteSpan buffer, const TimeoutType timeout) noexcept {
+			if (buffer.empty() || !PrepareCurrent()) return 0;
+			const auto deadline = timeout == NoTimeout
+				? std::chrono::steady_clock::time_point::max()
+				: std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout);
+			if (!WaitCurrent(deadline)) return 0;
+			return TakeCurrent(buffer);
+		}
+	};
+}
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "Verifier.hpp"
+
+namespace Cango :: inline ByteCommunication :: inline Core {
+	/// @brief 计算区间中所有字节的和
+	///	@details 编译时启用 AVX2 或 SSE2 时，使用 psadbw 每次将 32 或 16 个字节累加到 64 位整数中
+	[[nodiscard]] inline std::uint64_t SumBytes(const CByteSpan span) noexcept {
+		const auto* data = span.data();
+		const auto size = span.size();
+		SizeType offset{0};
+		std::uint64_t sum{0};
+
+#if defined(__AVX2__)
+		auto sum32 = _mm256_setzero_si256();
+		for (; offset + 32 <= size; offset += 32) {
+			const auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + offset));
+			sum32 = _mm256_add_epi64(sum32, _mm256_sad_epu8(block, _mm256_setzero_si256()));
+		}
+		std::uint64_t lanes32[4];
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes32), sum32);
+		sum += lanes32[0] + lanes32[1] + lanes32[2] + lanes32[3];
+#endif
+
+#if defined(__SSE2__)
+		auto sum16 = _mm_setzero_si128();
+		for (; offset + 16 <= size; offset += 16) {
+			const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset));
+			sum16 = _mm_add_epi64(sum16, _mm_sad_epu8(block, _mm_setzero_si128()));
+		}
+		std::uint64_t lanes16[2];
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes16), sum16);
+		sum += lanes16[0] + lanes16[1];
+#endif
+
+		for (; offset < size; ++offset) sum += data[offset];
+		return sum;
+	}
+
+	/// @brief 计算区间中所有字节的异或
+	///	@details 编译时启用 AVX2 或 SSE2 时每次异或 32 或 16 个字节，否则每次异或 8 个字节，最后折叠为一个字节
+	[[nodiscard]] inline ByteType XorBytes(const CByteSpan span) noexcept {
+		const auto* data = span.data();
+		const auto size = span.size();
+		SizeType offset{0};
+		std::uint64_t word_xor{0};
+
+#if defined(__AVX2__)
+		auto xor32 = _mm256_setzero_si256();
+		for (; offset + 32 <= size; offset += 32)
+			xor32 = _mm256_xor_si256(xor32, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + offset)));
+		std::uint64_t lanes32[4];
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes32), xor32);
+		word_xor ^= lanes32[0] ^ lanes32[1] ^ lanes32[2] ^ lanes32[3];
+#endif
+
+#if defined(__SSE2__)
+		auto xor16 = _mm_setzero_si128();
+		for (; offset + 16 <= size; offset += 16)
+			xor16 = _mm_xor_si128(xor16, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset)));
+		std::uint64_t lanes16[2];
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes16), xor16);
+		word_xor ^= lanes16[0] ^ lanes16[1];
+#endif
+
+		for (; offset + 8 <= size; offset += 8) {
+			std::uint64_t word;
+			std::memcpy(&word, data + offset, sizeof(word));
+			word_xor ^= word;
+		}
+		word_xor ^= word_xor >> 32;
+		word_xor ^= word_xor >> 16;
+		word_xor ^= word_xor >> 8;
+
+		auto result = static_cast<ByteType>(word_xor);
+		for (; offset < size; ++offset) result ^= data[offset];
+		return result;
+	}
+
+	/// @brief 检验数据包中的累加和
+	///	@details
+	///		累加和为覆盖范围内所有字节之和，截断为 TValue 的宽度，位于数据包末尾 TTrailingSize 个字节之前，按 TByteOrder 排列。
+	///		覆盖范围从 TBeginOffset 开始直到累加和之前，默认参数对应 @c TypedMessage 把累加和放在紧挨尾字节的位置。
+	///	@tparam TValue 累加和的类型，通常为 8 位或 16 位
+	template <
+		std::unsigned_integral TValue = std::uint8_t,
+		std::endian TByteOrder = std::endian::little,
+		SizeType TTrailingSize = 1,
+		SizeType TBeginOffset = 0>
+	class SumChecksumVerifier final {
+		static constexpr SizeType ValueSize = sizeof(TValue);
+
+	public:
+		using FoldStateType = std::uint64_t;
+
+		// ReSharper disable once CppMemberFunctionMayBeStatic
+		[[nodiscard]] bool Verify(const CByteSpan span) const noexcept { // NOLINT(*-convert-member-functions-to-static)
+			if (span.size() < TBeginOffset + ValueSize + TTrailingSize) return false;
+			const auto position = span.size() - TTrailingSize - ValueSize;
+			return static_cast<TValue>(SumBytes(span.subspan(TBeginOffset, position - TBeginOffset)))
+				== LoadInteger<TValue, TByteOrder>(span.subspan(position, ValueSize));
+		}
+
+		/// @brief 写入端使用，计算累加和并写入数据包中对应的位置
+		// ReSharper disable once CppMemberFunctionMayBeStatic
+		void Seal(const ByteSpan span) const noexcept { // NOLINT(*-convert-member-functions-to-static)
+			if (span.size() < TBeginOffset + ValueSize + TTrailingSize) return;
+			const auto position = span.size() - TTrailingSize - ValueSize;
+			StoreInteger<TValue, TByteOrder>(
+				span.subspan(position, ValueSize),
+				static_cast<TValue>(SumBytes(span.subspan(TBeginOffset, position - TBeginOffset))));
+		}
+
+		/// @brief 融合遍历接口，见 @c IsFoldingVerifier
+		// ReSharper disable once CppMemberFunctionMayBeStatic
+		[[nodiscard]] bool FoldRange(const SizeType size, SizeType& begin, SizeType& end) const noexcept { // NOLINT(*-convert-member-functions-to-static)
+			if (size < TBeginOffset + ValueSize + TTrailingSize) return false;
+			begin = TBeginOffset;
+			end = size - TTrailingSize - ValueSize;
+			return true;
+		}
+
+		// ReSharper disable once CppMemberFunctionMayBeStatic
+		[[nodiscard]] FoldStateType FoldBegin() const noexcept { return 0; } // NOLINT(*-convert-member-functions-to-static)
+
+		// ReSharper disable once CppMemberFunctionMayBeStatic
+		void Fold(FoldStateType& state, const CByteSpan chunk) const noexcept { state += SumBytes(chunk); } // NOLINT(*-convert-member-functions-to-static)
+
+		// ReSharper disable once CppMemberFunctionMayBeStatic
+		[[nodiscard]] bool FoldEnd(const FoldStateType state, const CByteSpan span) const noexcept { // NOLINT(*-convert-member-functions-to-static)
+			const auto position = span.size() - TTrailingSize - ValueSize;
+			return static_cast<TValue>(state) == LoadInteger<TValue, TByteOrder>(span.subspan(position, ValueSize));
+		}
+	};
+
+	/// @brief 检验数据包中的异或校验字节
+	///	@details 校验字节为覆盖范围内所有字节的异或，位于数据包末尾 TTrailingSize 个字节之前，覆盖范围从 TBeginOffset 开始直到校验字节之前
+	template <SizeType TTrailingSize = 1, SizeType TBeginOffset = 0>
+	class XorChecksumVerifier final {
+	public:
+		using FoldStateType = ByteType;
+
+		// ReSharper disable once CppMemberFunctionMayBeStatic
+		[[nodiscard]] bool Verify(const CByteSpan span) const noexcept { // NOLINT(*-convert-member-functions-to-static)
+			if (span.size() < TBeginOffset + 1 + TTrailingSize) return false;
+			const auto position = span.size() - TTrailingSize - 1;
+			return XorBytes(span.subspan(TBeginOffset, position - TBeginOffset)) == span[position];
+		}
+
+		/// @brief 写入端使用，计算异或校验字节并写入数据包中对应的位置
+		// ReSharper disable once CppMemberFunctionMayBeStatic
+		void Seal(const ByteSpan span) const noexcept { // NOLINT(*-convert-member-functions-to-static)
+			if (span.size() < TBeginOffset + 1 + TTrailingSize) return;
+			const auto position = span.size() - TTrailingSize - 1;
+			span[position] = XorBytes(span.subspan(TBeginOffset, position - TBeginOffset));
+		}
+
+		/// @brief 融合遍历接口，见 @c IsFoldingVerifier
+		// ReSharper disable once CppMemberFunctionMayBeStatic
+		[[nodiscard]] bool FoldRange(const SizeType size, SizeType& begin, SizeType& end) const noexcept { // NOLINT(*-convert-member-functions-to-static)
+			if (size < TBeginOffset + 1 + TTrailingSize) return false;
+			begin = TBeginOffset;
+			end = size - TTrailingSize - 1;
+			return true;
+		}
+
+		// ReSharper disable once CppMemberFunctionMayBeStatic
+		[[nodiscard]] FoldStateType FoldBegin() const noexcept { return 0; } // NOLINT(*-convert-member-functions-to-static)
+
+		// ReSharper disable once CppMemberFunctionMayBeStatic
+		void Fold(FoldStateType& state, const CByteSpan chunk) const noexcept { state ^= XorBytes(chunk); } // NOLINT(*-convert-member-functions-to-static)
+
+		// ReSharper disable once CppMemberFunctionMayBeStatic
+		[[nodiscard]] bool FoldEnd(const FoldStateType state, const CByteSpan span) const noexcept { // NOLINT(*-convert-member-functions-to-static)
+			return state == span[span.size() - TTrailingSize - 1];
+		}
+	};
+
+	template <SizeType TTrailingSize = 1, SizeType TBeginOffset = 0>
+	using Sum8Verifier = SumChecksumVerifier<std::uint8_t, std::endian::little, TTrailingSize, TBeginOffset>;
+
+	template <SizeType TTrailingSize = 1, SizeType TBeginOffset = 0>
+	using Sum16Verifier = SumChecksumVerifier<std::uint16_t, std::endian::little, TTrailingSize, TBeginOffset>;
+}
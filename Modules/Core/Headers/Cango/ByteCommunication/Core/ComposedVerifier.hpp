@@ -0,0 +1,132 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include <variant>
+
+#include "Verifier.hpp"
+
+namespace Cango :: inline ByteCommunication :: inline Core {
+	/// @brief 对一组 @c Verifier 中满足 @c IsFoldingVerifier 的部分进行融合遍历
+	///	@details
+	///		所有折叠范围的并集按 TChunkSize 分块，每一块依次交给覆盖它的 @c Verifier 处理，
+	///		数据包只从内存读取一次，后续 @c Verifier 处理同一块时数据已在一级缓存中，且各自的块处理仍可向量化。
+	///		不满足 @c IsFoldingVerifier 的 @c Verifier 在结果中为 true，由调用者单独检验。
+	///	@return 每个 @c Verifier 的检验结果
+	template <SizeType TChunkSize, typename... TVerifiers>
+	[[nodiscard]] std::array<bool, sizeof...(TVerifiers)> FoldVerifiers(
+		const CByteSpan span,
+		TVerifiers&... verifiers) noexcept {
+		using Indices = std::index_sequence_for<TVerifiers...>;
+		constexpr auto count = sizeof...(TVerifiers);
+
+		std::array<bool, count> results{};
+		std::array<SizeType, count> begins{};
+		std::array<SizeType, count> ends{};
+		auto all = std::tie(verifiers...);
+
+		// 未参与折叠的 Verifier 使用 std::monostate 占位
+		auto states = std::make_tuple([&verifiers] {
+			if constexpr (IsFoldingVerifier<TVerifiers>) return verifiers.FoldBegin();
+			else return std::monostate{};
+		}()...);
+
+		SizeType first{SIZE_MAX};
+		SizeType last{0};
+		[&]<SizeType... I>(std::index_sequence<I...>) {
+			([&] {
+				if constexpr (IsFoldingVerifier<std::tuple_element_t<I, std::tuple<TVerifiers...>>>) {
+					results[I] = std::get<I>(all).FoldRange(span.size(), begins[I], ends[I]);
+					if (!results[I] || begins[I] >= ends[I]) return;
+					first = std::min(first, begins[I]);
+					last = std::max(last, ends[I]);
+				}
+				else results[I] = true;
+			}(), ...);
+		}(Indices{});
+
+		for (auto chunk_begin = first; chunk_begin < last; chunk_begin += TChunkSize) {
+			const auto chunk_end = std::min(chunk_begin + TChunkSize, last);
+			[&]<SizeType... I>(std::index_sequence<I...>) {
+				([&] {
+					if constexpr (IsFoldingVerifier<std::tuple_element_t<I, std::tuple<TVerifiers...>>>) {
+						if (!results[I]) return;
+						const auto begin = std::max(begins[I], chunk_begin);
+						const auto end = std::min(ends[I], chunk_end);
+						if (begin < end) std::get<I>(all).Fold(std::get<I>(states), span.subspan(begin, end - begin));
+					}
+				}(), ...);
+			}(Indices{});
+		}
+
+		[&]<SizeType... I>(std::index_sequence<I...>) {
+			([&] {
+				if constexpr (IsFoldingVerifier<std::tuple_element_t<I, std::tuple<TVerifiers...>>>)
+					results[I] = results[I] && std::get<I>(all).FoldEnd(std::get<I>(states), span);
+			}(), ...);
+		}(Indices{});
+		return results;
+	}
+
+	/// @brief 所有 @c Verifier 都通过时才通过
+	///	@details
+	///		先按声明顺序检验不可融合的 @c Verifier (如头尾字节、长度)，任意一个不通过则立即返回；
+	///		再对所有 @c IsFoldingVerifier 的 @c Verifier (如校验和、CRC)进行一次融合遍历，见 @c FoldVerifiers 。
+	///		写入端可以调用 @c Seal ，按声明顺序调用所有提供 Seal 的 @c Verifier 。
+	template <IsVerifier... TVerifiers>
+	class AllOfVerifier final {
+	public:
+		std::tuple<TVerifiers...> Verifiers{};
+
+		[[nodiscard]] bool Verify(const CByteSpan span) noexcept {
+			return std::apply(
+				[span](auto&... verifiers) {
+					if (!((IsFoldingVerifier<std::remove_reference_t<decltype(verifiers)>> || verifiers.Verify(span)) && ...))
+						return false;
+					if constexpr ((IsFoldingVerifier<TVerifiers> || ...)) {
+						const auto results = FoldVerifiers<256>(span, verifiers...);
+						return std::ranges::all_of(results, [](const bool result) { return result; });
+					}
+					else return true;
+				},
+				Verifiers);
+		}
+
+		void Seal(const ByteSpan span) noexcept {
+			std::apply(
+				[span](auto&... verifiers) {
+					([&] { if constexpr (requires { verifiers.Seal(span); }) verifiers.Seal(span); }(), ...);
+				},
+				Verifiers);
+		}
+	};
+
+	/// @brief 任意一个 @c Verifier 通过即通过
+	///	@details
+	///		先按声明顺序检验不可融合的 @c Verifier ，任意一个通过则立即返回；
+	///		再对所有 @c IsFoldingVerifier 的 @c Verifier 进行一次融合遍历。
+	template <IsVerifier... TVerifiers>
+	class AnyOfVerifier final {
+	public:
+		std::tuple<TVerifiers...> Verifiers{};
+
+		[[nodiscard]] bool Verify(const CByteSpan span) noexcept {
+			return std::apply(
+				[span](auto&... verifiers) {
+					if (((!IsFoldingVerifier<std::remove_reference_t<decltype(verifiers)>> && verifiers.Verify(span)) || ...))
+						return true;
+					if constexpr ((IsFoldingVerifier<TVerifiers> || ...)) {
+						const auto results = FoldVerifiers<256>(span, verifiers...);
+						constexpr std::array is_folding{IsFoldingVerifier<TVerifiers>...};
+						for (SizeType index = 0; index < results.size(); ++index)
+							if (is_folding[index] && results[index]) return true;
+					}
+					return false;
+				},
+				Verifiers);
+		}
+	};
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace Cango :: inline ByteCommunication :: inline Core {
+	/// @brief @c ConnectionCounters 的快照
+	struct ConnectionStatistics {
+		/// @brief 从读取器读到的字节数
+		std::uint64_t BytesRead{0};
+
+		/// @brief 写入器写出的字节数
+		std::uint64_t BytesWritten{0};
+
+		/// @brief 通过检验并输出的数据包数量
+		std::uint64_t FramesEmitted{0};
+
+		/// @brief 数据包相对于读取边界的位置发生变化，即通过查找头字节重新对齐数据流的次数
+		std::uint64_t Resyncs{0};
+
+		/// @brief 以头字节开头但未通过检验的候选数据包数量
+		std::uint64_t VerifyRejects{0};
+
+		/// @brief 读到了字节但少于请求的字节数的次数，通常表示超时或连接断开，没有读到字节的读取不计入
+		std::uint64_t ShortReads{0};
+
+		/// @brief 第一次连接之后重新获得读写器的次数
+		std::uint64_t Reconnects{0};
+	};
+
+	/// @brief 独占一个缓存行的计数器，只使用 relaxed 的原子操作
+	struct alignas(64) RelaxedCounter {
+		std::atomic<std::uint64_t> Value{0};
+
+		void Add(const std::uint64_t count = 1) noexcept { Value.fetch_add(count, std::memory_order_relaxed); }
+
+		[[nodiscard]] std::uint64_t Load() const noexcept { return Value.load(std::memory_order_relaxed); }
+
+		void Reset() noexcept { Value.store(0, std::memory_order_relaxed); }
+	};
+
+	/// @brief 一个连接的计数器，读写路径只进行 relaxed 的原子加法，监控线程可以随时获取快照而不需要加锁
+	///	@details 各计数器位于不同的缓存行，读取线程和写入线程更新计数时不会互相干扰。快照中的各项之间不保证严格一致。
+	struct ConnectionCounters {
+		RelaxedCounter BytesRead{};
+		RelaxedCounter BytesWritten{};
+		RelaxedCounter FramesEmitted{};
+		RelaxedCounter Resyncs{};
+		RelaxedCounter VerifyRejects{};
+		RelaxedCounter ShortReads{};
+		RelaxedCounter Reconnects{};
+
+		[[nodiscard]] ConnectionStatistics Snapshot() const noexcept {
+			return {
+				.BytesRead = BytesRead.Load(),
+				.BytesWritten = BytesWritten.Load(),
+				.FramesEmitted = FramesEmitted.Load(),
+				.Resyncs = Resyncs.Load(),
+				.VerifyRejects = VerifyRejects.Load(),
+				.ShortReads = ShortReads.Load(),
+				.Reconnects = Reconnects.Load()
+			};
+		}
+
+		void Reset() noexcept {
+			BytesRead.Reset();
+			BytesWritten.Reset();
+			FramesEmitted.Reset();
+			Resyncs.Reset();
+			VerifyRejects.Reset();
+			ShortReads.Reset();
+			Reconnects.Reset();
+		}
+	};
+}
@@ -0,0 +1,230 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <nmmintrin.h>
+#endif
+
+#include "Verifier.hpp"
+
+namespace Cango :: inline ByteCommunication :: inline Core {
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+	/// @brief 当前处理器是否支持 SSE4.2 的 crc32 指令，只在第一次调用时检测
+	[[nodiscard]] inline bool IsCrc32cInstructionSupported() noexcept {
+		static const bool supported = __builtin_cpu_supports("sse4.2");
+		return supported;
+	}
+
+	/// @brief 使用 SSE4.2 的 crc32 指令更新 CRC-32C 寄存器
+	[[nodiscard]] __attribute__((target("sse4.2")))
+	inline std::uint32_t UpdateCrc32cByInstruction(std::uint32_t crc, const CByteSpan span) noexcept {
+		const auto* data = span.data();
+		auto size = span.size();
+		std::uint64_t crc64{crc};
+		for (; size >= 8; size -= 8, data += 8) {
+			std::uint64_t word;
+			std::memcpy(&word, data, sizeof(word));
+			crc64 = _mm_crc32_u64(crc64, word);
+		}
+		crc = static_cast<std::uint32_t>(crc64);
+		for (; size > 0; --size, ++data) crc = _mm_crc32_u8(crc, *data);
+		return crc;
+	}
+#else
+	[[nodiscard]] constexpr bool IsCrc32cInstructionSupported() noexcept { return false; }
+#endif
+
+	/// @brief 由参数确定的 CRC 算法，查找表在编译时生成
+	///	@details
+	///		反射(低位先行)的算法使用 slicing-by-8，每次处理 8 个字节；非反射的算法逐字节查表。
+	///		CRC-32C 在支持 SSE4.2 的处理器上会在运行时改用 crc32 指令。
+	///	@tparam TValue CRC 值的类型，宽度即为 CRC 位数
+	///	@tparam TPolynomial 多项式的常规(高位先行)表示
+	///	@tparam TInitial 寄存器初始值
+	///	@tparam TFinalXor 输出前与寄存器异或的值
+	///	@tparam TReflected 输入输出是否反射
+	template <std::unsigned_integral TValue, TValue TPolynomial, TValue TInitial, TValue TFinalXor, bool TReflected>
+	class CrcAlgorithm final {
+		static constexpr SizeType Width = sizeof(TValue) * 8;
+
+		[[nodiscard]] static constexpr TValue Reflect(TValue value) noexcept {
+			TValue result{0};
+			for (SizeType bit = 0; bit < Width; ++bit, value >>= 1)
+				result = static_cast<TValue>((result << 1) | (value & 1));
+			return result;
+		}
+
+		/// @brief Tables[k][i] 表示字节 i 之后再跟随 k 个 0 字节时对寄存器的影响，非反射算法只使用 Tables[0]
+		static constexpr std::array<std::array<TValue, 256>, 8> Tables = [] {
+			std::array<std::array<TValue, 256>, 8> tables{};
+			for (SizeType index = 0; index < 256; ++index) {
+				TValue crc;
+				if constexpr (TReflected) {
+					constexpr auto polynomial = Reflect(TPolynomial);
+					crc = static_cast<TValue>(index);
+					for (int bit = 0; bit < 8; ++bit)
+						crc = static_cast<TValue>((crc & 1) ? (crc >> 1) ^ polynomial : crc >> 1);
+				}
+				else {
+					constexpr auto top_bit = static_cast<TValue>(TValue{1} << (Width - 1));
+					crc = static_cast<TValue>(static_cast<TValue>(index) << (Width - 8));
+					for (int bit = 0; bit < 8; ++bit)
+						crc = static_cast<TValue>((crc & top_bit) ? (crc << 1) ^ TPolynomial : crc << 1);
+				}
+				tables[0][index] = crc;
+			}
+			if constexpr (TReflected)
+				for (SizeType slice = 1; slice < 8; ++slice)
+					for (SizeType index = 0; index < 256; ++index) {
+						const auto previous = tables[slice - 1][index];
+						tables[slice][index] = static_cast<TValue>((previous >> 8) ^ tables[0][previous & 0xFF]);
+					}
+			return tables;
+		}();
+
+		[[nodiscard]] static constexpr bool IsCrc32c() noexcept {
+			return TReflected && Width == 32 && TPolynomial == 0x1EDC6F41;
+		}
+
+	public:
+		using ValueType = TValue;
+
+		/// @brief 以寄存器当前值 crc 继续处理 span，不包含初始值和输出异或
+		[[nodiscard]] static TValue Update(TValue crc, const CByteSpan span) noexcept {
+			const auto* data = span.data();
+			auto size = span.size();
+
+			if constexpr (TReflected) {
+				if constexpr (IsCrc32c())
+					if (IsCrc32cInstructionSupported()) return UpdateCrc32cByInstruction(crc, span);
+
+				if constexpr (std::endian::native == std::endian::little) {
+					for (; size >= 8; size -= 8, data += 8) {
+						std::uint64_t word;
+						std::memcpy(&word, data, sizeof(word));
+						word ^= crc;
+						crc = static_cast<TValue>(
+							Tables[7][word & 0xFF] ^ Tables[6][(word >> 8) & 0xFF]
+							^ Tables[5][(word >> 16) & 0xFF] ^ Tables[4][(word >> 24) & 0xFF]
+							^ Tables[3][(word >> 32) & 0xFF] ^ Tables[2][(word >> 40) & 0xFF]
+							^ Tables[1][(word >> 48) & 0xFF] ^ Tables[0][word >> 56]);
+					}
+				}
+				for (; size > 0; --size, ++data)
+					crc = static_cast<TValue>((crc >> 8) ^ Tables[0][(crc ^ *data) & 0xFF]);
+			}
+			else {
+				for (; size > 0; --size, ++data)
+					crc = static_cast<TValue>((crc << 8) ^ Tables[0][((crc >> (Width - 8)) ^ *data) & 0xFF]);
+			}
+			return crc;
+		}
+
+		static constexpr TValue Initial = TInitial;
+
+		/// @brief 由寄存器的值得到最终的 CRC 值
+		[[nodiscard]] static constexpr TValue Finalize(const TValue crc) noexcept {
+			return static_cast<TValue>(crc ^ TFinalXor);
+		}
+
+		/// @brief 计算完整的 CRC 值
+		[[nodiscard]] static TValue Compute(const CByteSpan span) noexcept { return Finalize(Update(TInitial, span)); }
+	};
+
+	/// @brief CRC-8/SMBUS
+	using Crc8 = CrcAlgorithm<std::uint8_t, 0x07, 0x00, 0x00, false>;
+
+	/// @brief CRC-16/CCITT-FALSE
+	using Crc16Ccitt = CrcAlgorithm<std::uint16_t, 0x1021, 0xFFFF, 0x0000, false>;
+
+	/// @brief CRC-16/MODBUS
+	using Crc16Modbus = CrcAlgorithm<std::uint16_t, 0x8005, 0xFFFF, 0x0000, true>;
+
+	/// @brief CRC-32 (以太网、zlib 使用的版本)
+	using Crc32 = CrcAlgorithm<std::uint32_t, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, true>;
+
+	/// @brief CRC-32C (Castagnoli)
+	using Crc32c = CrcAlgorithm<std::uint32_t, 0x1EDC6F41, 0xFFFFFFFF, 0xFFFFFFFF, true>;
+
+	/// @brief 检验数据包中的 CRC 值
+	///	@details
+	///		CRC 值位于数据包末尾 TTrailingSize 个字节之前，按 TByteOrder 排列，
+	///		覆盖从 TBeginOffset 开始直到 CRC 值之前的所有字节。
+	///		默认参数对应 @c TypedMessage 把 CRC 放在数据区最后、紧挨尾字节的用法。
+	///	@tparam TAlgorithm CRC 算法，见 @c CrcAlgorithm
+	///	@tparam TByteOrder CRC 值的字节序
+	///	@tparam TTrailingSize CRC 值之后的字节数，如尾字节
+	///	@tparam TBeginOffset CRC 覆盖范围的起始位置
+	template <
+		typename TAlgorithm,
+		std::endian TByteOrder = std::endian::little,
+		SizeType TTrailingSize = 1,
+		SizeType TBeginOffset = 0>
+	class CrcVerifier final {
+		using ValueType = typename TAlgorithm::ValueType;
+		static constexpr SizeType ValueSize = sizeof(ValueType);
+
+	public:
+		using AlgorithmType = TAlgorithm;
+
+		// ReSharper disable once CppMemberFunctionMayBeStatic
+		[[nodiscard]] bool Verify(const CByteSpan span) const noexcept { // NOLINT(*-convert-member-functions-to-static)
+			if (span.size() < TBeginOffset + ValueSize + TTrailingSize) return false;
+			const auto position = span.size() - TTrailingSize - ValueSize;
+			return TAlgorithm::Compute(span.subspan(TBeginOffset, position - TBeginOffset))
+				== LoadInteger<ValueType, TByteOrder>(span.subspan(position, ValueSize));
+		}
+
+		using FoldStateType = ValueType;
+
+		/// @brief 融合遍历接口，见 @c IsFoldingVerifier
+		// ReSharper disable once CppMemberFunctionMayBeStatic
+		[[nodiscard]] bool FoldRange(const SizeType size, SizeType& begin, SizeType& end) const noexcept { // NOLINT(*-convert-member-functions-to-static)
+			if (size < TBeginOffset + ValueSize + TTrailingSize) return false;
+			begin = TBeginOffset;
+			end = size - TTrailingSize - ValueSize;
+			return true;
+		}
+
+		// ReSharper disable once CppMemberFunctionMayBeStatic
+		[[nodiscard]] ValueType FoldBegin() const noexcept { return TAlgorithm::Initial; } // NOLINT(*-convert-member-functions-to-static)
+
+		// ReSharper disable once CppMemberFunctionMayBeStatic
+		void Fold(ValueType& state, const CByteSpan chunk) const noexcept { state = TAlgorithm::Update(state, chunk); } // NOLINT(*-convert-member-functions-to-static)
+
+		// ReSharper disable once CppMemberFunctionMayBeStatic
+		[[nodiscard]] bool FoldEnd(const ValueType state, const CByteSpan span) const noexcept { // NOLINT(*-convert-member-functions-to-static)
+			const auto position = span.size() - TTrailingSize - ValueSize;
+			return TAlgorithm::Finalize(state) == LoadInteger<ValueType, TByteOrder>(span.subspan(position, ValueSize));
+		}
+
+		/// @brief 写入端使用，计算 CRC 值并写入数据包中对应的位置
+		// ReSharper disable once CppMemberFunctionMayBeStatic
+		void Seal(const ByteSpan span) const noexcept { // NOLINT(*-convert-member-functions-to-static)
+			if (span.size() < TBeginOffset + ValueSize + TTrailingSize) return;
+			const auto position = span.size() - TTrailingSize - ValueSize;
+			StoreInteger<ValueType, TByteOrder>(
+				span.subspan(position, ValueSize),
+				TAlgorithm::Compute(span.subspan(TBeginOffset, position - TBeginOffset)));
+		}
+	};
+
+	template <SizeType TTrailingSize = 1, SizeType TBeginOffset = 0>
+	using Crc8Verifier = CrcVerifier<Crc8, std::endian::little, TTrailingSize, TBeginOffset>;
+
+	template <SizeType TTrailingSize = 1, SizeType TBeginOffset = 0>
+	using Crc16CcittVerifier = CrcVerifier<Crc16Ccitt, std::endian::big, TTrailingSize, TBeginOffset>;
+
+	template <SizeType TTrailingSize = 1, SizeType TBeginOffset = 0>
+	using Crc16ModbusVerifier = CrcVerifier<Crc16Modbus, std::endian::little, TTrailingSize, TBeginOffset>;
+
+	template <SizeType TTrailingSize = 1, SizeType TBeginOffset = 0>
+	using Crc32Verifier = CrcVerifier<Crc32, std::endian::little, TTrailingSize, TBeginOffset>;
+
+	template <SizeType TTrailingSize = 1, SizeType TBeginOffset = 0>
+	using Crc32cVerifier = CrcVerifier<Crc32c, std::endian::little, TTrailingSize, TBeginOffset>;
+}
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "ByteTypes.hpp"
+
+namespace Cango :: inline ByteCommunication :: inline Core {
+	/// @brief 与给定大小相同的无符号整数类型
+	template <SizeType TSize>
+	using UnsignedOfSize =
+		std::conditional_t<TSize == 1, std::uint8_t,
+		std::conditional_t<TSize == 2, std::uint16_t,
+		std::conditional_t<TSize == 4, std::uint32_t,
+		std::conditional_t<TSize == 8, std::uint64_t, void>>>>;
+
+	/// @brief 反转整数的字节序，编译为单条 bswap/rev 指令
+	template <std::unsigned_integral TValue>
+	[[nodiscard]] constexpr TValue ByteSwap(const TValue value) noexcept {
+		if constexpr (sizeof(TValue) == 1) return value;
+#if defined(__GNUC__) || defined(__clang__)
+		else if constexpr (sizeof(TValue) == 2) return __builtin_bswap16(value);
+		else if constexpr (sizeof(TValue) == 4) return __builtin_bswap32(value);
+		else if constexpr (sizeof(TValue) == 8) return __builtin_bswap64(value);
+#endif
+		else {
+			TValue result{0};
+			for (SizeType index = 0; index < sizeof(TValue); ++index)
+				result = static_cast<TValue>(result | (((value >> (index * 8)) & 0xFF) << ((sizeof(TValue) - 1 - index) * 8)));
+			return result;
+		}
+	}
+
+	/// @brief 可以作为数据字段的类型：整数、浮点数和枚举，大小为 1、2、4 或 8 字节
+	template <typename TValue>
+	concept IsDataFieldValue =
+		(std::is_arithmetic_v<TValue> || std::is_enum_v<TValue>)
+		&& !std::is_void_v<UnsignedOfSize<sizeof(TValue)>>;
+
+	/// @brief 数据区中位于固定偏移量、按固定字节序存放的字段
+	///	@details
+	///		读写使用 memcpy 访问未对齐的字节，字节序与本机不同时再反转一次，
+	///		编译器会将其优化为一次(未对齐)加载加一条 bswap，在不允许未对齐访问的平台上也是安全的。
+	///	@tparam TValue 字段在本机的类型
+	///	@tparam TOffset 字段在数据区中的偏移量
+	///	@tparam TByteOrder 字段在数据区中的字节序
+	template <IsDataFieldValue TValue, SizeType TOffset, std::endian TByteOrder = std::endian::little>
+	struct DataField {
+		using ValueType = TValue;
+		static constexpr SizeType Offset = TOffset;
+		static constexpr SizeType Size = sizeof(TValue);
+		static constexpr std::endian ByteOrder = TByteOrder;
+
+		/// @brief 从数据区读取字段
+		///	@param data 数据区，大小不能小于 Offset + Size
+		[[nodiscard]] static TValue Load(const CByteSpan data) noexcept {
+			using RawType = UnsignedOfSize<Size>;
+			RawType raw;
+			std::memcpy(&raw, data.data() + TOffset, Size);
+			if constexpr (TByteOrder != std::endian::native) raw = ByteSwap(raw);
+			return std::bit_cast<TValue>(raw);
+		}
+
+		/// @brief 将字段写入数据区
+		///	@param data 数据区，大小不能小于 Offset + Size
+		static void Store(const ByteSpan data, const TValue value) noexcept {
+			using RawType = UnsignedOfSize<Size>;
+			auto raw = std::bit_cast<RawType>(value);
+			if constexpr (TByteOrder != std::endian::native) raw = ByteSwap(raw);
+			std::memcpy(data.data() + TOffset, &raw, Size);
+		}
+	};
+
+	/// @brief 满足 @c DataField 接口的类型
+	template <typename TField>
+	concept IsDataField = requires(CByteSpan data, ByteSpan output, typename TField::ValueType value) {
+		{ TField::Offset } -> std::convertible_to<SizeType>;
+		{ TField::Size } -> std::convertible_to<SizeType>;
+		{ TField::Load(data) } -> std::same_as<typename TField::ValueType>;
+		TField::Store(output, value);
+	};
+
+	namespace Details {
+		template <typename TMemberPointer>
+		struct MemberPointerTraits;
+
+		template <typename TObject, typename TValue>
+		struct MemberPointerTraits<TValue TObject::*> {
+			using ObjectType = TObject;
+			using ValueType = TValue;
+		};
+	}
+
+	/// @brief 与本机结构的成员绑定的 @c DataField ，用于 @c DataSchema
+	///	@tparam TMember 成员指针，如 @c &Status::Speed
+	template <auto TMember, SizeType TOffset, std::endian TByteOrder = std::endian::little>
+	requires std::is_member_object_pointer_v<decltype(TMember)>
+	struct MemberField : DataField<typename Details::MemberPointerTraits<decltype(TMember)>::ValueType, TOffset, TByteOrder> {
+		using ObjectType = typename Details::MemberPointerTraits<decltype(TMember)>::ObjectType;
+		static constexpr auto Member = TMember;
+	};
+
+	/// @brief 描述数据区布局的字段表，在本机结构和数据区之间整体转换
+	///	@details
+	///		字段之间不能重叠，在编译时检查。
+	///		@c Decode 和 @c Encode 按字段展开为一系列独立的加载和存储，不经过整个结构的中间复制。
+	///	@tparam TObject 本机结构，按本机对齐，不需要与数据区布局一致
+	///	@tparam TFields 一系列绑定到 TObject 成员的 @c MemberField
+	template <typename TObject, typename... TFields>
+	requires (std::same_as<typename TFields::ObjectType, TObject> && ...)
+	class DataSchema final {
+		[[nodiscard]] static consteval bool HasNoOverlap() noexcept {
+			constexpr SizeType offsets[]{TFields::Offset..., 0};
+			constexpr SizeType sizes[]{TFields::Size..., 0};
+			for (SizeType i = 0; i < sizeof...(TFields); ++i)
+				for (SizeType j = i + 1; j < sizeof...(TFields); ++j)
+					if (offsets[i] < offsets[j] + sizes[j] && offsets[j] < offsets[i] + sizes[i]) return false;
+			return true;
+		}
+
+		static_assert(HasNoOverlap(), "fields in a data schema must not overlap");
+
+	public:
+		using ObjectType = TObject;
+
+		/// @brief 数据区至少需要的字节数
+		static constexpr SizeType RequiredSize = std::max({SizeType{0}, (TFields::Offset + TFields::Size)...});
+
+		/// @brief 从数据区读取所有字段到本机结构
+		///	@param data 数据区，大小不能小于 @c RequiredSize
+		static void Decode(const CByteSpan data, TObject& object) noexcept {
+			((object.*TFields::Member = TFields::Load(data)), ...);
+		}
+
+		/// @brief 从数据区读取所有字段，构造本机结构
+		[[nodiscard]] static TObject Decode(const CByteSpan data) noexcept {
+			TObject object{};
+			Decode(data, object);
+			return object;
+		}
+
+		/// @brief 将本机结构的所有字段写入数据区，不属于任何字段的字节保持不变
+		///	@param data 数据区，大小不能小于 @c RequiredSize
+		static void Encode(const TObject& object, const ByteSpan data) noexcept {
+			(TFields::Store(data, object.*TFields::Member), ...);
+		}
+	};
+
+	/// @brief 满足 @c DataSchema 接口的类型
+	template <typename TSchema>
+	concept IsDataSchema = requires(CByteSpan data, ByteSpan output, typename TSchema::ObjectType& object) {
+		{ TSchema::RequiredSize } -> std::convertible_to<SizeType>;
+		TSchema::Decode(data, object);
+		TSchema::Encode(object, output);
+	};
+}
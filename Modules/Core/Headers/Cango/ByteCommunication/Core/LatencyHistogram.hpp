@@ -0,0 +1,198 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+
+#include <Cango/CommonUtils/ObjectOwnership.hpp>
+
+#include "ByteTypes.hpp"
+
+namespace Cango :: inline ByteCommunication :: inline Core {
+	/// @brief 是否记录通信流程各阶段的耗时，定义 CANGO_ENABLE_LATENCY_HISTOGRAM 时启用
+	///	@details
+	///		未启用时 @c PipelineLatencyRecorder 和 @c LatencyScope 都是空类型，读写路径上不会读取时钟。
+	///		此定义改变多个适配器的布局，应通过 CMake 选项 CANGO_ENABLE_LATENCY_HISTOGRAM 在 Core 目标上统一设置，
+	///		同一程序中的所有编译单元必须一致。
+#if defined(CANGO_ENABLE_LATENCY_HISTOGRAM)
+	inline constexpr bool IsLatencyHistogramEnabled = true;
+#else
+	inline constexpr bool IsLatencyHistogramEnabled = false;
+#endif
+
+	/// @brief 对数分桶的布局，与 HDR 直方图相同
+	///	@details
+	///		小于 SubBucketCount 的值各占一个桶；之后每个 2 的幂区间等分为 SubBucketCount 个桶，
+	///		相对误差不超过 1 / SubBucketCount 。超过 2^MaxBits 纳秒(约 18 分钟)的值计入最后一个桶。
+	struct LatencyBuckets {
+		static constexpr SizeType SubBucketBits = 4;
+		static constexpr SizeType SubBucketCount = SizeType{1} << SubBucketBits;
+		static constexpr SizeType MaxBits = 40;
+		static constexpr SizeType Count = (MaxBits - SubBucketBits + 1) * SubBucketCount;
+
+		[[nodiscard]] static constexpr SizeType IndexOf(const std::uint64_t nanoseconds) noexcept {
+			if (nanoseconds < SubBucketCount) return static_cast<SizeType>(nanoseconds);
+			const auto magnitude = static_cast<SizeType>(std::bit_width(nanoseconds)) - 1;
+			if (magnitude >= MaxBits) return Count - 1;
+			const auto shift = magnitude - SubBucketBits;
+			return (shift + 1) * SubBucketCount + static_cast<SizeType>((nanoseconds >> shift) - SubBucketCount);
+		}
+
+		/// @brief 桶中的最大值
+		[[nodiscard]] static constexpr std::uint64_t UpperBoundOf(const SizeType index) noexcept {
+			if (index < SubBucketCount) return index;
+			const auto shift = index / SubBucketCount - 1;
+			const auto sub_bucket = index % SubBucketCount + SubBucketCount;
+			return ((std::uint64_t{sub_bucket} + 1) << shift) - 1;
+		}
+	};
+
+	/// @brief @c LatencyHistogram 的快照
+	struct LatencySnapshot {
+		std::array<std::uint64_t, LatencyBuckets::Count> Counts{};
+		std::uint64_t Count{0};
+		std::uint64_t TotalNanoseconds{0};
+		std::uint64_t MaxNanoseconds{0};
+
+		/// @brief 分位数所在桶的最大值，不超过记录到的最大值
+		///	@param quantile [0, 1] 之间的分位数
+		[[nodiscard]] std::chrono::nanoseconds GetPercentile(const double quantile) const noexcept {
+			if (Count == 0) return {};
+			const auto rank = static_cast<std::uint64_t>(std::clamp(quantile, 0.0, 1.0) * static_cast<double>(Count - 1));
+			std::uint64_t seen = 0;
+			for (SizeType index = 0; index < Counts.size(); ++index) {
+				seen += Counts[index];
+				if (seen > rank)
+					return std::chrono::nanoseconds{std::min(LatencyBuckets::UpperBoundOf(index), MaxNanoseconds)};
+			}
+			return std::chrono::nanoseconds{MaxNanoseconds};
+		}
+
+		[[nodiscard]] std::chrono::nanoseconds GetMean() const noexcept {
+			return std::chrono::nanoseconds{Count == 0 ? 0 : TotalNanoseconds / Count};
+		}
+
+		/// @brief 合并另一个快照，用于汇总多个连接
+		void Merge(const LatencySnapshot& other) noexcept {
+			for (SizeType index = 0; index < Counts.size(); ++index) Counts[index] += other.Counts[index];
+			Count += other.Count;
+			TotalNanoseconds += other.TotalNanoseconds;
+			MaxNanoseconds = std::max(MaxNanoseconds, other.MaxNanoseconds);
+		}
+	};
+
+	/// @brief 无锁的对数分桶耗时直方图，见 @c LatencyBuckets
+	///	@details 记录时只对计数进行 relaxed 的原子加法，任意线程可以随时获取快照，快照中的各项之间不保证严格一致
+	class LatencyHistogram final {
+		std::array<std::atomic<std::uint64_t>, LatencyBuckets::Count> Counts{};
+		std::atomic<std::uint64_t> TotalNanoseconds{0};
+		std::atomic<std::uint64_t> MaxNanoseconds{0};
+
+	public:
+		void Record(const std::chrono::nanoseconds duration) noexcept {
+			const auto nanoseconds = static_cast<std::uint64_t>(std::max<std::chrono::nanoseconds::rep>(duration.count(), 0));
+			Counts[LatencyBuckets::IndexOf(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+			TotalNanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+			auto max = MaxNanoseconds.load(std::memory_order_relaxed);
+			while (nanoseconds > max && !MaxNanoseconds.compare_exchange_weak(max, nanoseconds, std::memory_order_relaxed)) {}
+		}
+
+		[[nodiscard]] LatencySnapshot Snapshot() const noexcept {
+			LatencySnapshot snapshot{};
+			for (SizeType index = 0; index < Counts.size(); ++index) {
+				snapshot.Counts[index] = Counts[index].load(std::memory_order_relaxed);
+				snapshot.Count += snapshot.Counts[index];
+			}
+			snapshot.TotalNanoseconds = TotalNanoseconds.load(std::memory_order_relaxed);
+			snapshot.MaxNanoseconds = MaxNanoseconds.load(std::memory_order_relaxed);
+			return snapshot;
+		}
+
+		/// @brief 清空记录，与 Record 并发时可能保留少量记录
+		void Reset() noexcept {
+			for (auto& count : Counts) count.store(0, std::memory_order_relaxed);
+			TotalNanoseconds.store(0, std::memory_order_relaxed);
+			MaxNanoseconds.store(0, std::memory_order_relaxed);
+		}
+	};
+
+	/// @brief @c PipelineLatencies 的快照
+	struct PipelineLatencySnapshot {
+		LatencySnapshot Read{};
+		LatencySnapshot Frame{};
+		LatencySnapshot HandOff{};
+		LatencySnapshot Write{};
+	};
+
+	/// @brief 一个连接在通信流程各阶段的耗时
+	struct PipelineLatencies {
+		/// @brief 读取器的一次读取
+		LatencyHistogram Read{};
+
+		/// @brief 在读到的字节中查找并检验数据包
+		LatencyHistogram Frame{};
+
+		/// @brief 读取任务将消息交给读取消息目标
+		LatencyHistogram HandOff{};
+
+		/// @brief 写入器的一次写入
+		LatencyHistogram Write{};
+
+		[[nodiscard]] PipelineLatencySnapshot Snapshot() const noexcept {
+			return {Read.Snapshot(), Frame.Snapshot(), HandOff.Snapshot(), Write.Snapshot()};
+		}
+
+		void Reset() noexcept {
+			Read.Reset();
+			Frame.Reset();
+			HandOff.Reset();
+			Write.Reset();
+		}
+	};
+}
+
+namespace Cango :: inline ByteCommunication :: inline Core :: Details {
+	/// @brief 未启用耗时记录时代替记录相关成员的空类型，接受任何赋值
+	struct LatencyDisabled {
+		constexpr LatencyDisabled& operator=(const auto&) noexcept { return *this; }
+	};
+}
+
+namespace Cango :: inline ByteCommunication :: inline Core {
+	/// @brief 只在启用耗时记录时存在的类型，否则为空类型，应与 [[no_unique_address]] 一起使用
+	template <typename T>
+	using LatencyOnly = std::conditional_t<IsLatencyHistogramEnabled, T, Details::LatencyDisabled>;
+
+	/// @brief 适配器记录耗时的位置，为空时不记录
+	using PipelineLatencyRecorder = LatencyOnly<ObjectUser<PipelineLatencies>>;
+
+	/// @brief 将作用域的耗时记录到 recorder 的一个阶段
+#if defined(CANGO_ENABLE_LATENCY_HISTOGRAM)
+	class LatencyScope final {
+		LatencyHistogram* Histogram;
+		std::chrono::steady_clock::time_point Begin{};
+
+	public:
+		LatencyScope(const PipelineLatencyRecorder& recorder, LatencyHistogram PipelineLatencies::* stage) noexcept :
+			Histogram(recorder ? &((*recorder).*stage) : nullptr) {
+			if (Histogram) Begin = std::chrono::steady_clock::now();
+		}
+
+		LatencyScope(const LatencyScope&) = delete;
+		LatencyScope& operator=(const LatencyScope&) = delete;
+
+		~LatencyScope() noexcept {
+			if (Histogram) Histogram->Record(std::chrono::steady_clock::now() - Begin);
+		}
+	};
+#else
+	class LatencyScope final {
+	public:
+		constexpr LatencyScope(const PipelineLatencyRecorder&, LatencyHistogram PipelineLatencies::*) noexcept {}
+	};
+#endif
+}
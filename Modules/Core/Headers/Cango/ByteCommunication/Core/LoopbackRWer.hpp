@@ -0,0 +1,280 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+#include <Cango/CommonUtils/AsyncItemPool.hpp>
+#include <Cango/CommonUtils/ObjectOwnership.hpp>
+#include <Cango/TaskDesign/DeliveryTask.hpp>
+
+#include "RWer.hpp"
+
+namespace Cango :: inline ByteCommunication :: inline Core {
+	/// @brief 单生产者单消费者的无锁字节环形队列
+	///	@details
+	///		写入位置和读取位置各自只由一方修改，并放在不同的缓存行上。
+	///		无限等待时使用 std::atomic 的 wait/notify，有截止时间时使用条件变量，数据就绪时读写都不需要系统调用。
+	///		关闭后写入立即返回，读取在取完剩余字节后返回。
+	///	@tparam TCapacity 容量，必须为 2 的幂
+	template <SizeType TCapacity>
+	requires (std::has_single_bit(TCapacity))
+	class SpscByteRing final {
+		static constexpr SizeType Mask = TCapacity - 1;
+
+		/// @brief 读取位置，只由消费者修改
+		alignas(64) std::atomic<SizeType> Head{0};
+
+		/// @brief 写入位置，只由生产者修改
+		alignas(64) std::atomic<SizeType> Tail{0};
+
+		/// @brief 每次读取、写入或关闭后递增，用于唤醒等待的一方
+		alignas(64) std::atomic<std::uint32_t> Events{0};
+		std::atomic_bool Closed{false};
+
+		/// @brief 正在等待条件变量的线程数，为 0 时 @c Signal 不获取互斥锁
+		std::atomic<std::uint32_t> TimedWaiters{0};
+		std::mutex TimedMutex{};
+		std::condition_variable TimedCondition{};
+
+		alignas(64) std::array<ByteType, TCapacity> Bytes{};
+
+		void Signal() noexcept {
+			// 与 WaitUntil 中 TimedWaiters 的递增构成顺序一致的配对，任一方都能看到另一方的修改
+			Events.fetch_add(1, std::memory_order_seq_cst);
+			Events.notify_all();
+			if (TimedWaiters.load(std::memory_order_seq_cst) == 0) return;
+			std::lock_guard lock{TimedMutex};
+			TimedCondition.notify_all();
+		}
+
+		/// @brief 等待事件计数离开 events，或等到截止时间
+		///	@return 截止时间前是否发生了事件
+		[[nodiscard]] bool WaitUntil(
+			const std::uint32_t events,
+			const std::chrono::steady_clock::time_point deadline) noexcept {
+			if (deadline == std::chrono::steady_clock::time_point::max()) {
+				Events.wait(events, std::memory_order_acquire);
+				return true;
+			}
+			// std::atomic::wait 不支持超时，有截止时间时阻塞在条件变量上
+			TimedWaiters.fetch_add(1, std::memory_order_seq_cst);
+			std::unique_lock lock{TimedMutex};
+			const auto is_signaled = TimedCondition.wait_until(
+				lock, deadline, [this, events] { return Events.load(std::memory_order_seq_cst) != events; });
+			lock.unlock();
+			TimedWaiters.fetch_sub(1, std::memory_order_relaxed);
+			return is_signaled;
+		}
+
+		[[nodiscard]] static std::chrono::steady_clock::time_point ToDeadline(const TimeoutType timeout) noexcept {
+			if (timeout == NoTimeout) return std::chrono::steady_clock::time_point::max();
+			return std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout);
+		}
+
+	public:
+		static constexpr SizeType Capacity = TCapacity;
+
+		/// @brief 写入尽可能多的字节，不等待
+		///	@return 写入的字节数
+		[[nodiscard]] SizeType TryWrite(const CByteSpan buffer) noexcept {
+			const auto tail = Tail.load(std::memory_order_relaxed);
+			const auto head = Head.load(std::memory_order_acquire);
+			const auto count = std::min(buffer.size(), TCapacity - (tail - head));
+			if (count == 0) return 0;
+
+			const auto offset = tail & Mask;
+			const auto first = std::min(count, TCapacity - offset);
+			std::copy_n(buffer.data(), first, Bytes.data() + offset);
+			std::copy_n(buffer.data() + first, count - first, Bytes.data());
+			Tail.store(tail + count, std::memory_order_release);
+			Signal();
+			return count;
+		}
+
+		/// @brief 读取尽可能多的字节，不等待
+		///	@return 读取的字节数
+		[[nodiscard]] SizeType TryRead(const ByteSpan buffer) noexcept {
+			const auto head = Head.load(std::memory_order_relaxed);
+			const auto tail = Tail.load(std::memory_order_acquire);
+			const auto count = std::min(buffer.size(), tail - head);
+			if (count == 0) return 0;
+
+			const auto offset = head & Mask;
+			const auto first = std::min(count, TCapacity - offset);
+			std::copy_n(Bytes.data() + offset, first, buffer.data());
+			std::copy_n(Bytes.data(), count - first, buffer.data() + first);
+			Head.store(head + count, std::memory_order_release);
+			Signal();
+			return count;
+		}
+
+		/// @brief 写入所有字节，队列满时等待消费者
+		///	@return 写入的字节数，队列关闭时可能小于 buffer.size()
+		[[nodiscard]] SizeType Write(const CByteSpan buffer) noexcept {
+			SizeType written = 0;
+			while (written < buffer.size()) {
+				const auto events = Events.load(std::memory_order_acquire);
+				if (IsClosed()) break;
+				const auto bytes = TryWrite(buffer.subspan(written));
+				written += bytes;
+				if (bytes == 0) (void)WaitUntil(events, std::chrono::steady_clock::time_point::max());
+			}
+			return written;
+		}
+
+		/// @brief 读取字节，直到缓冲区填满或队列关闭且已读空
+		///	@return 读取的字节数
+		[[nodiscard]] SizeType Read(const ByteSpan buffer) noexcept {
+			SizeType read = 0;
+			while (read < buffer.size()) {
+				const auto events = Events.load(std::memory_order_acquire);
+				const auto closed = IsClosed();
+				const auto bytes = TryRead(buffer.subspan(read));
+				read += bytes;
+				if (bytes != 0) continue;
+				if (closed) break;
+				(void)WaitUntil(events, std::chrono::steady_clock::time_point::max());
+			}
+			return read;
+		}
+
+		/// @brief 读取当前可用的字节，队列为空时最多等待 timeout
+		///	@return 读取的字节数，超时或队列关闭且已读空时为 0
+		[[nodiscard]] SizeType ReadSome(const ByteSpan buffer, const TimeoutType timeout) noexcept {
+			if (buffer.empty()) return 0;
+			const auto deadline = ToDeadline(timeout);
+			while (true) {
+				const auto events = Events.load(std::memory_order_acquire);
+				const auto closed = IsClosed();
+				if (const auto bytes = TryRead(buffer); bytes != 0) return bytes;
+				if (closed || !WaitUntil(events, deadline)) return 0;
+			}
+		}
+
+		/// @brief 关闭队列，唤醒所有等待的读写操作
+		void Close() noexcept {
+			Closed.store(true, std::memory_order_release);
+			Signal();
+		}
+
+		[[nodiscard]] bool IsClosed() const noexcept { return Closed.load(std::memory_order_acquire); }
+	};
+
+	/// @brief 进程内回环读写器的一端，从输入队列读取，向输出队列写入
+	///	@details
+	///		由 @c LoopbackRWerPair 创建并连接，不经过操作系统，可用于测试和测量库本身的开销。
+	///		任意一端关闭或析构后两个方向的队列都会关闭，另一端的读取在取完剩余字节后返回。
+	template <SizeType TCapacity = SizeType{1} << 16>
+	class LoopbackRWer final {
+	public:
+		using RingType = SpscByteRing<TCapacity>;
+
+	private:
+		ObjectUser<RingType> Input{};
+		ObjectUser<RingType> Output{};
+
+		struct Configurations {
+			struct ActorsType {
+				ObjectUser<RingType>& Input;
+				ObjectUser<RingType>& Output;
+			} Actors;
+		};
+
+	public:
+		LoopbackRWer() noexcept = default;
+
+		~LoopbackRWer() noexcept { Close(); }
+
+		LoopbackRWer(const LoopbackRWer&) = delete;
+		LoopbackRWer& operator=(const LoopbackRWer&) = delete;
+
+		[[nodiscard]] Configurations Configure() noexcept { return {.Actors = {Input, Output}}; }
+
+		[[nodiscard]] bool IsFunctional() const noexcept { return ValidateAll(Input, Output); }
+
+		/// @brief 读取字节，直到缓冲区填满或连接关闭
+		[[nodiscard]] SizeType ReadBytes(const ByteSpan buffer) noexcept {
+			return Input ? Input->Read(buffer) : 0;
+		}
+
+		/// @brief 读取当前可用的字节，没有可用字节时最多等待 timeout
+		[[nodiscard]] SizeType ReadSome(const ByteSpan buffer, const TimeoutType timeout) noexcept {
+			return Input ? Input->ReadSome(buffer, timeout) : 0;
+		}
+
+		/// @brief 写入所有字节，对方来不及读取时等待
+		[[nodiscard]] SizeType WriteBytes(const CByteSpan buffer) noexcept {
+			return Output ? Output->Write(buffer) : 0;
+		}
+
+		/// @brief 关闭两个方向的队列
+		void Close() noexcept {
+			if (Input) Input->Close();
+			if (Output) Output->Close();
+		}
+	};
+
+	/// @brief 通过两个 @c SpscByteRing 相互连接的一对回环读写器
+	///	@details First 写入的字节由 Second 读取，反之亦然
+	template <SizeType TCapacity = SizeType{1} << 16>
+	struct LoopbackRWerPair {
+		using RWerType = LoopbackRWer<TCapacity>;
+
+		Owner<RWerType> First{};
+		Owner<RWerType> Second{};
+
+		LoopbackRWerPair() noexcept {
+			const Owner<typename RWerType::RingType> forward{};
+			const Owner<typename RWerType::RingType> backward{};
+			const auto first = First->Configure();
+			first.Actors.Input = backward;
+			first.Actors.Output = forward;
+			const auto second = Second->Configure();
+			second.Actors.Input = forward;
+			second.Actors.Output = backward;
+		}
+	};
+
+	/// @brief 回环读写器的提供者，每次 GetItem 创建一对新的回环读写器
+	///	@details
+	///		First 交给调用者(通常是 @c CommunicationTask )，Second 交给 PeerDestination，
+	///		由测试代码从中取出并扮演远端设备。
+	template <
+		SizeType TCapacity = SizeType{1} << 16,
+		IsItemDestination TPeerDestination = AsyncItemPool<Owner<LoopbackRWer<TCapacity>>>>
+	class LoopbackRWerProvider final {
+		Credential<TPeerDestination> PeerDestination{};
+
+		struct Configurations {
+			struct ActorsType {
+				Credential<TPeerDestination>& PeerDestination;
+			} Actors;
+		};
+
+	public:
+		using RWerType = LoopbackRWer<TCapacity>;
+		using ItemType = Owner<RWerType>;
+
+		[[nodiscard]] Configurations Configure() noexcept { return {.Actors = {PeerDestination}}; }
+
+		[[nodiscard]] bool IsFunctional() const noexcept { return Validate(PeerDestination); }
+
+		/// @brief 创建一对回环读写器，将另一端交给 PeerDestination
+		///	@return PeerDestination 不可用时返回 false
+		bool GetItem(ItemType& rw) noexcept {
+			const auto destination_user = PeerDestination.lock();
+			if (!destination_user) return false;
+
+			LoopbackRWerPair<TCapacity> pair{};
+			destination_user->SetItem(pair.Second);
+			rw = pair.First;
+			return true;
+		}
+	};
+}
@@ -0,0 +1,266 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <concepts>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <thread>
+
+#include "ByteTypes.hpp"
+#include "NotifyingItemPool.hpp"
+
+namespace Cango :: inline ByteCommunication :: inline Core {
+	/// @brief 队列已满时放入物品的处理方式
+	enum class OverflowPolicy : std::uint8_t {
+		/// @brief 丢弃队列中最早的物品，保留最新的物品
+		DropOldest,
+		/// @brief 丢弃正在放入的物品
+		DropNewest,
+		/// @brief 等待消费者取出物品，最多等待 BlockTimeout ，超时或被 Wake 唤醒后丢弃正在放入的物品
+		Block
+	};
+
+	/// @brief 无锁的有界消息队列，可以替代 @c AsyncItemPool 作为任务的消息源或消息目标
+	///	@details
+	///		每个位置带有序号，生产者和消费者通过序号判断位置是否可用，读写位置分别放在不同的缓存行上。
+	///		GetItem 在队列为空时立即返回 false，与 @c AsyncItemPool 相同，由任务的 MinInterval 控制轮询。
+	///		队列已满时按 Policy 处理，DropOldest 时生产者代替消费者取出最早的物品，因此消费者的取出总是使用 CAS。
+	///		SetItems 检查连续的空位后通过一次 CAS 占用，空位足够时整批物品不会与其他生产者的物品交错。
+	///		Block 时生产者短暂自旋后阻塞在条件变量上，由取出物品的线程唤醒；等待有上限，
+	///		消费者停止后生产者(如读取任务)仍能返回并检查自己的监视器；需要立即结束等待时调用 @c Wake 。
+	///	@tparam TCapacity 容量，必须为 2 的幂
+	///	@tparam TIsMultiProducer 是否允许多个线程同时放入，为 false 时生产者不需要 CAS
+	///	@note 只允许一个消费者线程
+	template <std::default_initializable TItem, SizeType TCapacity, bool TIsMultiProducer>
+	requires (std::has_single_bit(TCapacity) && std::copyable<TItem>)
+	class BoundedMessageQueue final {
+		static constexpr SizeType Mask = TCapacity - 1;
+
+		struct Slot {
+			std::atomic<SizeType> Sequence{0};
+			TItem Item{};
+		};
+
+		alignas(64) std::atomic<SizeType> EnqueuePosition{0};
+		alignas(64) std::atomic<SizeType> DequeuePosition{0};
+		alignas(64) std::atomic<std::uint64_t> DroppedCount{0};
+		OverflowPolicy Policy{OverflowPolicy::DropOldest};
+		std::chrono::microseconds BlockTimeout{10000};
+		std::atomic<std::uint64_t> WakeCount{0};
+
+		/// @brief 以 Block 方式等待的生产者数量，为 0 时取出物品不获取互斥锁
+		alignas(64) std::atomic<std::uint32_t> BlockedProducers{0};
+		/// @brief 有生产者等待时每次取出物品递增
+		std::atomic<std::uint32_t> PopEvents{0};
+		std::mutex BlockMutex{};
+		std::condition_variable BlockCondition{};
+
+		alignas(64) std::array<Slot, TCapacity> Slots{};
+
+		struct Configurations {
+			struct OptionsType {
+				OverflowPolicy& Policy;
+				/// @brief Block 时放入一个物品的最长等待时间
+				std::chrono::microseconds& BlockTimeout;
+			} Options;
+		};
+
+		/// @brief 取出物品后唤醒以 Block 方式等待的生产者
+		void NotifyProducers() noexcept {
+			// 与 PushWithin 中的栅栏配对，生产者要么看到空出的位置，要么被这里唤醒
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (BlockedProducers.load(std::memory_order_relaxed) == 0) return;
+			PopEvents.fetch_add(1, std::memory_order_release);
+			std::lock_guard lock{BlockMutex};
+			BlockCondition.notify_all();
+		}
+
+		/// @brief 等待队列出现空位后放入物品，每放入一部分物品重新计算等待时间
+		///	@return 放入的物品数量，超时或被 @c Wake 唤醒时少于 items 的数量
+		[[nodiscard]] SizeType PushWithin(const std::span<const TItem> items) noexcept {
+			const auto wake_count = WakeCount.load(std::memory_order_relaxed);
+			auto deadline = std::chrono::steady_clock::now() + BlockTimeout;
+			auto pushed = TryPushSome(items);
+			// 消费者正在取出时空位很快出现，先自旋和让出，消费者停顿时才阻塞，避免每个物品都进行一次系统调用
+			for (SizeType spin = 0; pushed < items.size() && spin < 128; ++spin) {
+				if (spin < 64) Details::CpuRelax();
+				else std::this_thread::yield();
+				pushed += TryPushSome(items.subspan(pushed));
+			}
+
+			while (pushed < items.size()) {
+				BlockedProducers.fetch_add(1, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				const auto events = PopEvents.load(std::memory_order_acquire);
+				const auto count = TryPushSome(items.subspan(pushed));
+				if (count == 0) {
+					std::unique_lock lock{BlockMutex};
+					BlockCondition.wait_until(lock, deadline, [this, events, wake_count] {
+						return PopEvents.load(std::memory_order_acquire) != events
+							|| WakeCount.load(std::memory_order_relaxed) != wake_count;
+					});
+				}
+				BlockedProducers.fetch_sub(1, std::memory_order_relaxed);
+
+				if (count != 0) {
+					pushed += count;
+					deadline = std::chrono::steady_clock::now() + BlockTimeout;
+				}
+				else if (WakeCount.load(std::memory_order_relaxed) != wake_count
+					|| std::chrono::steady_clock::now() >= deadline)
+					break;
+			}
+			return pushed;
+		}
+
+	public:
+		using ItemType = TItem;
+		static constexpr SizeType Capacity = TCapacity;
+
+		BoundedMessageQueue() noexcept {
+			for (SizeType index = 0; index < TCapacity; ++index)
+				Slots[index].Sequence.store(index, std::memory_order_relaxed);
+		}
+
+		BoundedMessageQueue(const BoundedMessageQueue&) = delete;
+		BoundedMessageQueue& operator=(const BoundedMessageQueue&) = delete;
+
+		/// @brief 选项应在任务开始传递消息前设置
+		[[nodiscard]] Configurations Configure() noexcept { return {.Options = {Policy, BlockTimeout}}; }
+
+		/// @brief 检查从 EnqueuePosition 开始的连续空位，通过一次 CAS 全部占用后放入物品，不等待
+		///	@return 放入的物品数量，队列已满时返回 0
+		[[nodiscard]] SizeType TryPushSome(const std::span<const TItem> items) noexcept {
+			const auto limit = std::min(items.size(), TCapacity);
+			auto position = EnqueuePosition.load(std::memory_order_relaxed);
+			while (limit != 0) {
+				SizeType count = 0;
+				for (; count < limit; ++count) {
+					const auto sequence = Slots[(position + count) & Mask].Sequence.load(std::memory_order_acquire);
+					if (sequence != position + count) break;
+				}
+				if (count == 0) {
+					const auto sequence = Slots[position & Mask].Sequence.load(std::memory_order_acquire);
+					if (static_cast<std::ptrdiff_t>(sequence - position) < 0) return 0;
+					position = EnqueuePosition.load(std::memory_order_relaxed);
+					continue;
+				}
+
+				// 位置在 CAS 成功前不会被其他生产者占用，检查过的空位在占用后仍然可用
+				if constexpr (TIsMultiProducer) {
+					if (!EnqueuePosition.compare_exchange_weak(position, position + count, std::memory_order_relaxed))
+						continue;
+				}
+				else EnqueuePosition.store(position + count, std::memory_order_relaxed);
+
+				for (SizeType index = 0; index < count; ++index) {
+					auto& slot = Slots[(position + index) & Mask];
+					slot.Item = items[index];
+					slot.Sequence.store(position + index + 1, std::memory_order_release);
+				}
+				return count;
+			}
+			return 0;
+		}
+
+		/// @brief 放入物品，不等待
+		///	@return 队列已满时返回 false
+		[[nodiscard]] bool TryPush(const TItem& item) noexcept { return TryPushSome({&item, 1}) != 0; }
+
+		/// @brief 取出最早的物品，不等待
+		///	@return 队列为空时返回 false
+		[[nodiscard]] bool TryPop(TItem& item) noexcept {
+			auto position = DequeuePosition.load(std::memory_order_relaxed);
+			while (true) {
+				auto& slot = Slots[position & Mask];
+				const auto sequence = slot.Sequence.load(std::memory_order_acquire);
+				const auto difference = static_cast<std::ptrdiff_t>(sequence - (position + 1));
+				if (difference < 0) return false;
+				if (difference > 0) {
+					position = DequeuePosition.load(std::memory_order_relaxed);
+					continue;
+				}
+				if (!DequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					continue;
+
+				item = slot.Item;
+				slot.Sequence.store(position + TCapacity, std::memory_order_release);
+				if (Policy == OverflowPolicy::Block) NotifyProducers();
+				return true;
+			}
+		}
+
+		/// @brief 按 Policy 放入物品
+		void SetItem(const TItem& item) noexcept { SetItems({&item, 1}); }
+
+		/// @brief 按 Policy 放入一批物品，有空位时一次占用多个位置
+		void SetItems(std::span<const TItem> items) noexcept {
+			while (!items.empty()) {
+				if (const auto count = TryPushSome(items); count != 0) {
+					items = items.subspan(count);
+					continue;
+				}
+
+				switch (Policy) {
+				case OverflowPolicy::DropNewest:
+					DroppedCount.fetch_add(items.size(), std::memory_order_relaxed);
+					return;
+				case OverflowPolicy::DropOldest: {
+					TItem dropped{};
+					if (TryPop(dropped)) DroppedCount.fetch_add(1, std::memory_order_relaxed);
+					else Details::CpuRelax(); // 最早的位置正在被消费者读取
+					break;
+				}
+				case OverflowPolicy::Block:
+					DroppedCount.fetch_add(items.size() - PushWithin(items), std::memory_order_relaxed);
+					return;
+				}
+			}
+		}
+
+		/// @brief 取出最早的物品
+		///	@return 队列为空时返回 false
+		bool GetItem(TItem& item) noexcept { return TryPop(item); }
+
+		/// @brief 取出多个物品，最多填满 items
+		///	@return 取出的物品数量
+		[[nodiscard]] SizeType GetItems(const std::span<TItem> items) noexcept {
+			SizeType count = 0;
+			while (count < items.size() && TryPop(items[count])) ++count;
+			return count;
+		}
+
+		/// @brief 使正在以 Block 方式等待的生产者立即放弃，用于中断任务时缩短等待
+		void Wake() noexcept {
+			WakeCount.fetch_add(1, std::memory_order_relaxed);
+			std::lock_guard lock{BlockMutex};
+			BlockCondition.notify_all();
+		}
+
+		/// @brief 队列中物品数量的近似值
+		[[nodiscard]] SizeType GetSize() const noexcept {
+			const auto dequeue = DequeuePosition.load(std::memory_order_relaxed);
+			const auto enqueue = EnqueuePosition.load(std::memory_order_relaxed);
+			return enqueue > dequeue ? enqueue - dequeue : 0;
+		}
+
+		/// @brief 因队列已满而丢弃的物品数量
+		[[nodiscard]] std::uint64_t GetDroppedCount() const noexcept {
+			return DroppedCount.load(std::memory_order_relaxed);
+		}
+	};
+
+	/// @brief 单生产者单消费者的有界消息队列，适合作为读取任务的消息目标
+	template <std::default_initializable TItem, SizeType TCapacity = 1024>
+	using SpscMessageQueue = BoundedMessageQueue<TItem, TCapacity, false>;
+
+	/// @brief 多生产者单消费者的有界消息队列，适合作为写入任务的消息源
+	template <std::default_initializable TItem, SizeType TCapacity = 1024>
+	using MpscMessageQueue = BoundedMessageQueue<TItem, TCapacity, true>;
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+#include "ByteTypes.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+namespace Cango :: inline ByteCommunication :: inline Core :: Details {
+	/// @brief 自旋等待时提示处理器降低功耗并让出流水线，不进行系统调用
+	inline void CpuRelax() noexcept {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+		_mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+		asm volatile("yield");
+#endif
+	}
+}
+
+namespace Cango :: inline ByteCommunication :: inline Core {
+	/// @brief 放入物品时唤醒等待者的单物品池，可以替代 @c AsyncItemPool 作为写入任务的消息源
+	///	@details
+	///		与 @c AsyncItemPool 相同，只保存最新放入的物品。
+	///		GetItem 在池为空时先自旋 SpinCount 次，再阻塞等待 SetItem 的通知，最多等待 WaitTimeout 后返回 false，
+	///		使 @c DeliveryTask 能够检查监视器。配合 MinInterval 为 0 的任务，
+	///		消息放入后立即被取出，空闲时不占用处理器。
+	///		@c Wake 可以立即唤醒所有等待者，用于中断任务时缩短等待。
+	template <typename TItem>
+	class NotifyingItemPool final {
+		std::mutex Mutex{};
+		std::condition_variable Condition{};
+		TItem Item{};
+		std::atomic_bool HasItem{false};
+		std::uint64_t WakeCount{0};
+
+		SizeType SpinCount{0};
+		std::chrono::microseconds WaitTimeout{10000};
+
+		struct Configurations {
+			struct OptionsType {
+				SizeType& SpinCount;
+				std::chrono::microseconds& WaitTimeout;
+			} Options;
+		};
+
+	public:
+		using ItemType = TItem;
+
+		[[nodiscard]] Configurations Configure() noexcept { return {.Options = {SpinCount, WaitTimeout}}; }
+
+		/// @brief 取出物品，池为空时自旋后阻塞等待
+		///	@return 等待超时或被 @c Wake 唤醒时仍为空则返回 false
+		bool GetItem(TItem& item) noexcept {
+			for (SizeType spin = 0; spin < SpinCount && !HasItem.load(std::memory_order_acquire); ++spin)
+				Details::CpuRelax();
+
+			std::unique_lock lock{Mutex};
+			if (!HasItem.load(std::memory_order_relaxed)) {
+				const auto wake_count = WakeCount;
+				Condition.wait_for(lock, WaitTimeout, [this, wake_count] {
+					return HasItem.load(std::memory_order_relaxed) || WakeCount != wake_count;
+				});
+				if (!HasItem.load(std::memory_order_relaxed)) return false;
+			}
+			item = Item;
+			HasItem.store(false, std::memory_order_relaxed);
+			return true;
+		}
+
+		/// @brief 取出物品，不等待
+		///	@return 池为空时返回 false
+		bool TryGetItem(TItem& item) noexcept {
+			if (!HasItem.load(std::memory_order_acquire)) return false;
+			std::lock_guard lock{Mutex};
+			if (!HasItem.load(std::memory_order_relaxed)) return false;
+			item = Item;
+			HasItem.store(false, std::memory_order_relaxed);
+			return true;
+		}
+
+		/// @brief 放入物品，覆盖未取出的物品，并唤醒一个等待者
+		void SetItem(const TItem& item) noexcept {
+			{
+				std::lock_guard lock{Mutex};
+				Item = item;
+				HasItem.store(true, std::memory_order_release);
+			}
+			Condition.notify_one();
+		}
+
+		/// @brief 唤醒所有等待者，它们的 GetItem 在池为空时立即返回 false
+		void Wake() noexcept {
+			{
+				std::lock_guard lock{Mutex};
+				++WakeCount;
+			}
+			Condition.notify_all();
+		}
+	};
+}
@@ -1,10 +1,25 @@
 #pragma once
 
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
 #include <Cango/CommonUtils/AsyncItemPool.hpp>
 #include <Cango/TaskDesign/DeliveryTask.hpp>
 
+#include "ByteStuffing.hpp"
+#include "LatencyHistogram.hpp"
+#include "MessageQueue.hpp"
+#include "NotifyingItemPool.hpp"
 #include "PPBuffer.hpp"
 #include "RWer.hpp"
+#include "RingFramer.hpp"
+#include "VariableFrame.hpp"
 
 namespace Cango :: inline ByteCommunication :: inline Core {
 	using ReaderProvider = ItemSource<Owner<RuntimeReader>>;
@@ -42,15 +57,31 @@ namespace Cango :: inline ByteCommunication :: inline Core {
 		typename TObject = typename TOwner::element_type>
 	concept IsRWerProvider = IsItemSource<TItemSource> && IsRWer<TObject>;
 
+	/// @brief 基于 @c PingPongSpan 的读取器适配器，每次读取一个消息大小的字节
+	///	@details 启用 @c IsLatencyHistogramEnabled 时，将每次读取和 @c PingPongSpan 的检验耗时记录到 Latencies
 	template <IsReader TReader, std::default_initializable TMessage, IsVerifier TVerifier>
 	class ReaderToMessageSourceAdapter final {
 		ReaderBuffer<TMessage> Buffer{};
 		PingPongSpan<TVerifier> Exchanger{Buffer};
 		ObjectUser<TReader> Reader{};
+		[[no_unique_address]] PipelineLatencyRecorder Latencies{};
+
+		/// @brief 读取一个消息大小的字节到 PongSpan
+		[[nodiscard]] bool ReadIntoExchanger() noexcept {
+			LatencyScope scope{Latencies, &PipelineLatencies::Read};
+			const auto bytes = Reader->ReadBytes(Exchanger.PongSpan);
+			if (const auto& counters = Exchanger.Counters) {
+				counters->BytesRead.Add(bytes);
+				if (bytes != 0 && bytes != sizeof(TMessage)) counters->ShortReads.Add();
+			}
+			return bytes == sizeof(TMessage);
+		}
 
 		struct Configurations {
 			struct ActorsType {
 				ObjectUser<TReader>& Reader;
+				PipelineLatencyRecorder& Latencies;
+				ObjectUser<ConnectionCounters>& Counters;
 			} Actors;
 
 			struct OptionsType {
@@ -66,7 +97,7 @@ namespace Cango :: inline ByteCommunication :: inline Core {
 
 		[[nodiscard]] Configurations Configure() noexcept {
 			return {
-				.Actors = {Reader},
+				.Actors = {Reader, Latencies, Exchanger.Counters},
 				.Options = {
 					Exchanger.HeadByte,
 					Exchanger.Verifier
@@ -77,11 +108,158 @@ namespace Cango :: inline ByteCommunication :: inline Core {
 		[[nodiscard]] bool IsFunctional() const noexcept { return ValidateAll(Reader); }
 
 		[[nodiscard]] bool GetItem(TMessage& message) noexcept {
-			return Reader->ReadBytes(Exchanger.PongSpan) == sizeof(TMessage)
-				&& Exchanger.Examine(ByteSpan{reinterpret_cast<ByteType*>(&message), sizeof(TMessage)});
+			Exchanger.PrepareNextRead(); // 完成之前 GetView 推迟的交换，否则读取会覆盖尚未复制到 PingSpan 的字节
+			if (!ReadIntoExchanger()) return false;
+			LatencyScope scope{Latencies, &PipelineLatencies::Frame};
+			return Exchanger.Examine(ByteSpan{reinterpret_cast<ByteType*>(&message), sizeof(TMessage)});
+		}
+
+		/// @brief 获取指向内部缓冲区的消息，不复制数据
+		///	@param frame 消息所在的字节区间，在下一次读取前有效
+		[[nodiscard]] bool GetView(CByteSpan& frame) noexcept {
+			Exchanger.PrepareNextRead();
+			if (!ReadIntoExchanger()) return false;
+			LatencyScope scope{Latencies, &PipelineLatencies::Frame};
+			return Exchanger.ExamineView(frame);
+		}
+
+		/// @brief 批量获取消息，双缓冲区每次读取最多输出一个消息
+		///	@return 写入 messages 的消息数量
+		[[nodiscard]] SizeType GetItems(const std::span<TMessage> messages) noexcept {
+			if (messages.empty()) return 0;
+			Exchanger.PrepareNextRead();
+			if (!ReadIntoExchanger()) return 0;
+			LatencyScope scope{Latencies, &PipelineLatencies::Frame};
+			return Exchanger.ExamineAll(messages);
+		}
+	};
+
+	/// @brief 从读取器读取字节，直接写入分帧器的环形缓冲区
+	///	@details
+	///		读取器满足 @c IsPartialReader 时，一次取走所有可用的字节，直到填满缓冲区的连续可写部分，readSize 不起作用；
+	///		否则阻塞读取 readSize 个字节。
+	///		分帧器设置了 Counters 时记录读到的字节数，阻塞读取得到的字节少于请求的字节数时记为一次 ShortReads
+	///	@return 实际读取的字节数
+	template <IsReader TReader, typename TFramer>
+	[[nodiscard]] SizeType ReadIntoFramer(TReader& reader, TFramer& framer, const SizeType readSize) noexcept {
+		const auto span = framer.WritableSpan();
+		SizeType bytes;
+		SizeType requested{0};
+		if constexpr (IsPartialReader<TReader>) bytes = reader.ReadSome(span, NoTimeout);
+		else {
+			requested = std::min(span.size(), std::max(readSize, SizeType{1}));
+			bytes = reader.ReadBytes(span.first(requested));
+		}
+		framer.Commit(bytes);
+		if (const auto& counters = framer.Counters) {
+			counters->BytesRead.Add(bytes);
+			if (bytes != 0 && bytes < requested) counters->ShortReads.Add();
+		}
+		return bytes;
+	}
+
+	/// @brief 基于 @c RingFramer 的读取器适配器，每次读取可以返回任意数量的字节
+	///	@details
+	///		缓冲区中已有完整数据包时直接输出，不再读取；否则读取字节后再查找数据包，见 @c ReadIntoFramer 。
+	///		Counters 即分帧器的计数器，设置后记录读取、分帧、重新同步和检验失败的次数
+	template <
+		IsReader TReader,
+		std::default_initializable TMessage,
+		IsVerifier TVerifier,
+		SizeType TCapacity = SizeType{1} << 17>
+	class StreamReaderToMessageSourceAdapter final {
+		using FramerType = MessageRingFramer<TMessage, TVerifier, TCapacity>;
+
+		FramerType Framer{};
+		ObjectUser<TReader> Reader{};
+		SizeType ReadSize{sizeof(TMessage)};
+
+		/// @brief 读取字节到分帧器，见 @c ReadIntoFramer
+		///	@return 实际读取的字节数
+		[[nodiscard]] SizeType ReadIntoFramer() noexcept { return Cango::ReadIntoFramer(*Reader, Framer, ReadSize); }
+
+		struct Configurations {
+			struct ActorsType {
+				ObjectUser<TReader>& Reader;
+				ObjectUser<ConnectionCounters>& Counters;
+			} Actors;
+
+			struct OptionsType {
+				ByteType& HeadByte;
+				TVerifier& Verifier;
+				SizeType& ReadSize;
+			} Options;
+		};
+
+	public:
+		using ReaderType = TReader;
+		using ItemType = TMessage;
+		using VerifierType = TVerifier;
+
+		[[nodiscard]] Configurations Configure() noexcept {
+			return {
+				.Actors = {Reader, Framer.Counters},
+				.Options = {
+					Framer.HeadByte,
+					Framer.Verifier,
+					ReadSize
+				}
+			};
+		}
+
+		[[nodiscard]] bool IsFunctional() const noexcept { return ValidateAll(Reader); }
+
+		[[nodiscard]] bool GetItem(TMessage& message) noexcept {
+			const ByteSpan destination{reinterpret_cast<ByteType*>(&message), sizeof(TMessage)};
+			if (Framer.Examine(destination)) return true;
+			return ReadIntoFramer() != 0 && Framer.Examine(destination);
+		}
+
+		/// @brief 获取指向内部缓冲区的消息，不复制数据
+		///	@param frame 消息所在的字节区间，在下一次读取前有效
+		[[nodiscard]] bool GetView(CByteSpan& frame) noexcept {
+			if (Framer.Next(frame)) return true;
+			return ReadIntoFramer() != 0 && Framer.Next(frame);
+		}
+
+		/// @brief 批量获取消息，先取出缓冲区中已有的所有消息，如果没有再读取一次
+		///	@return 写入 messages 的消息数量
+		[[nodiscard]] SizeType GetItems(const std::span<TMessage> messages) noexcept {
+			if (const auto count = Framer.ExamineAll(messages); count != 0 || messages.empty()) return count;
+			return ReadIntoFramer() == 0 ? 0 : Framer.ExamineAll(messages);
+		}
+	};
+
+	/// @brief 将消息交给消息目标，并记录交付耗时到 @c PipelineLatencies::HandOff
+	template <IsItemDestination TMessageDestination>
+	class HandOffLatencyAdapter final {
+		Credential<TMessageDestination> MessageDestination{};
+		PipelineLatencyRecorder Latencies{};
+
+		struct Configurations {
+			struct ActorsType {
+				Credential<TMessageDestination>& MessageDestination;
+				PipelineLatencyRecorder& Latencies;
+			} Actors;
+		};
+
+	public:
+		using ItemType = typename TMessageDestination::ItemType;
+
+		[[nodiscard]] Configurations Configure() noexcept { return {.Actors = {MessageDestination, Latencies}}; }
+
+		[[nodiscard]] bool IsFunctional() const noexcept { return Validate(MessageDestination); }
+
+		void SetItem(const ItemType& item) noexcept {
+			const auto destination_user = MessageDestination.lock();
+			if (!destination_user) return;
+			LatencyScope scope{Latencies, &PipelineLatencies::HandOff};
+			destination_user->SetItem(item);
 		}
 	};
 
+	/// @brief 从读取器读取消息并交给消息目标的任务
+	///	@details 启用 @c IsLatencyHistogramEnabled 时，任务和消息目标之间插入 @c HandOffLatencyAdapter
 	template <
 		IsReader TReader,
 		IsVerifier TVerifier,
@@ -90,14 +268,24 @@ namespace Cango :: inline ByteCommunication :: inline Core {
 		std::default_initializable TMessage = typename TMessageDestination::ItemType>
 	class DeliveryTaskAsReaderConsumer final {
 		using AdapterType = ReaderToMessageSourceAdapter<TReader, TMessage, TVerifier>;
+		using HandOffType = HandOffLatencyAdapter<TMessageDestination>;
+		using DestinationType = std::conditional_t<IsLatencyHistogramEnabled, HandOffType, TMessageDestination>;
 
 		Owner<AdapterType> AdapterOwner{};
-		DeliveryTask<AdapterType, TMessageDestination, TTaskMonitor> Task{};
+		[[no_unique_address]] LatencyOnly<Owner<HandOffType>> HandOffOwner{};
+		DeliveryTask<AdapterType, DestinationType, TTaskMonitor> Task{};
+
+		[[nodiscard]] Credential<TMessageDestination>& MessageDestination() noexcept {
+			if constexpr (IsLatencyHistogramEnabled) return HandOffOwner->Configure().Actors.MessageDestination;
+			else return Task.Configure().Actors.ItemDestination;
+		}
 
 		struct Configurations {
 			struct ActorsType {
 				Credential<TMessageDestination>& MessageDestination;
 				Credential<TTaskMonitor>& Monitor;
+				PipelineLatencyRecorder& Latencies;
+				ObjectUser<ConnectionCounters>& Counters;
 			} Actors;
 
 			struct OptionsType {
@@ -110,15 +298,21 @@ namespace Cango :: inline ByteCommunication :: inline Core {
 	public:
 		using ItemType = ObjectUser<TReader>;
 
-		DeliveryTaskAsReaderConsumer() noexcept { Task.Configure().Actors.ItemSource = AdapterOwner; }
+		DeliveryTaskAsReaderConsumer() noexcept {
+			const auto actors = Task.Configure().Actors;
+			actors.ItemSource = AdapterOwner;
+			if constexpr (IsLatencyHistogramEnabled) actors.ItemDestination = HandOffOwner;
+		}
 
 		[[nodiscard]] Configurations Configure() noexcept {
 			auto&& adapter = AdapterOwner->Configure();
 			auto&& delivery = Task.Configure();
 			return {
 				.Actors = {
-					delivery.Actors.ItemDestination,
-					delivery.Actors.Monitor
+					MessageDestination(),
+					delivery.Actors.Monitor,
+					adapter.Actors.Latencies,
+					adapter.Actors.Counters
 				},
 				.Options = {
 					adapter.Options.HeadByte,
@@ -129,8 +323,350 @@ namespace Cango :: inline ByteCommunication :: inline Core {
 		}
 
 		[[nodiscard]] bool IsFunctional() noexcept {
+			return Validate(MessageDestination(), Task.Configure().Actors.Monitor);
+		}
+
+		void SetItem(const ObjectUser<TReader>& reader) noexcept {
+			const auto monitor_user = Task.Configure().Actors.Monitor.lock();
+			if (!monitor_user || !reader) return;
+
+			monitor_user->Reset();
+			Execute(reader);
+		}
+
+		/// @brief 从读取器读取消息，直到监视器被中断，不重置监视器
+		///	@details 用于由调用者统一重置监视器的场合，避免覆盖其他线程已经发出的中断
+		void Execute(const ObjectUser<TReader>& reader) noexcept {
+			if (!reader) return;
+			const auto actors = AdapterOwner->Configure().Actors;
+			actors.Reader = reader;
+			if constexpr (IsLatencyHistogramEnabled) HandOffOwner->Configure().Actors.Latencies = actors.Latencies;
+			Task.Execute();
+		}
+	};
+
+	/// @brief 基于 @c VariableRingFramer 的读取器适配器，输出长度可变的数据包
+	///	@note
+	///		ReadSize 默认为 0，表示按 @c VariableRingFramer::MissingSize 读取，即先读取头部，再读取头部指示的剩余字节，
+	///		每个数据包通常只需两次读取，阻塞读取的设备也不会因为等待下一个数据包的字节而卡住；
+	///		读取器满足 @c IsPartialReader 时一次取走所有可用的字节，不需要设置此值
+	template <
+		IsReader TReader,
+		IsFrameLengthRule TLengthRule,
+		IsVerifier TVerifier,
+		SizeType TCapacity = SizeType{1} << 17>
+	class VariableReaderToMessageSourceAdapter final {
+		using FramerType = VariableRingFramer<TLengthRule, TVerifier, TCapacity>;
+
+		FramerType Framer{};
+		ObjectUser<TReader> Reader{};
+		SizeType ReadSize{0};
+
+		/// @brief 读取字节到分帧器，见 @c ReadIntoFramer
+		///	@return 实际读取的字节数
+		[[nodiscard]] SizeType ReadIntoFramer() noexcept {
+			return Cango::ReadIntoFramer(*Reader, Framer, ReadSize != 0 ? ReadSize : Framer.MissingSize());
+		}
+
+		struct Configurations {
+			struct ActorsType {
+				ObjectUser<TReader>& Reader;
+				ObjectUser<ConnectionCounters>& Counters;
+			} Actors;
+
+			struct OptionsType {
+				ByteType& HeadByte;
+				TLengthRule& LengthRule;
+				TVerifier& Verifier;
+				SizeType& ReadSize;
+			} Options;
+		};
+
+	public:
+		using ReaderType = TReader;
+		using ItemType = typename FramerType::FrameType;
+		using VerifierType = TVerifier;
+
+		[[nodiscard]] Configurations Configure() noexcept {
+			return {
+				.Actors = {Reader, Framer.Counters},
+				.Options = {
+					Framer.HeadByte,
+					Framer.LengthRule,
+					Framer.Verifier,
+					ReadSize
+				}
+			};
+		}
+
+		[[nodiscard]] bool IsFunctional() const noexcept { return ValidateAll(Reader); }
+
+		[[nodiscard]] bool GetItem(ItemType& frame) noexcept {
+			if (Framer.Examine(frame)) return true;
+			return ReadIntoFramer() != 0 && Framer.Examine(frame);
+		}
+
+		/// @brief 获取指向内部缓冲区的数据包，不复制数据
+		///	@param frame 数据包所在的字节区间，在下一次读取前有效
+		[[nodiscard]] bool GetView(CByteSpan& frame) noexcept {
+			if (Framer.Next(frame)) return true;
+			return ReadIntoFramer() != 0 && Framer.Next(frame);
+		}
+
+		/// @brief 批量获取数据包，先取出缓冲区中已有的所有数据包，如果没有再读取一次
+		///	@return 写入 frames 的数据包数量
+		[[nodiscard]] SizeType GetItems(const std::span<ItemType> frames) noexcept {
+			if (const auto count = Framer.ExamineAll(frames); count != 0 || frames.empty()) return count;
+			return ReadIntoFramer() == 0 ? 0 : Framer.ExamineAll(frames);
+		}
+	};
+
+	/// @brief 基于 @c DelimitedRingFramer 的读取器适配器，从字节填充编码的数据流中取出消息
+	///	@details @c GetItem 只输出解码后长度恰好为 sizeof(TMessage) 的数据包，@c GetView 输出任意长度的数据包
+	///	@note
+	///		ReadSize 默认为 0，表示按 @c DelimitedRingFramer::MissingSize 读取，一个消息通常只需一次读取，
+	///		阻塞读取的设备也不会因为等待下一个数据包的字节而卡住；数据包可能短于 sizeof(TMessage) 时应将 ReadSize 设为 1。
+	///		读取器满足 @c IsPartialReader 时一次取走所有可用的字节，不需要设置此值
+	template <
+		IsReader TReader,
+		std::default_initializable TMessage,
+		IsByteStuffingCodec TCodec,
+		IsVerifier TVerifier,
+		SizeType TMaxFrameSize = sizeof(TMessage),
+		SizeType TCapacity = SizeType{1} << 17>
+	class DelimitedReaderToMessageSourceAdapter final {
+		using FramerType = DelimitedRingFramer<TCodec, TVerifier, TMaxFrameSize, TCapacity>;
+
+		FramerType Framer{};
+		ObjectUser<TReader> Reader{};
+		SizeType ReadSize{0};
+
+		/// @brief 读取字节到分帧器，见 @c ReadIntoFramer
+		///	@return 实际读取的字节数
+		[[nodiscard]] SizeType ReadIntoFramer() noexcept {
+			return Cango::ReadIntoFramer(*Reader, Framer, ReadSize != 0 ? ReadSize : Framer.MissingSize(sizeof(TMessage)));
+		}
+
+		struct Configurations {
+			struct ActorsType {
+				ObjectUser<TReader>& Reader;
+				ObjectUser<ConnectionCounters>& Counters;
+			} Actors;
+
+			struct OptionsType {
+				TVerifier& Verifier;
+				SizeType& ReadSize;
+			} Options;
+		};
+
+	public:
+		using ReaderType = TReader;
+		using ItemType = TMessage;
+		using VerifierType = TVerifier;
+
+		[[nodiscard]] Configurations Configure() noexcept {
+			return {
+				.Actors = {Reader, Framer.Counters},
+				.Options = {
+					Framer.Verifier,
+					ReadSize
+				}
+			};
+		}
+
+		[[nodiscard]] bool IsFunctional() const noexcept { return ValidateAll(Reader); }
+
+		[[nodiscard]] bool GetItem(TMessage& message) noexcept {
+			const ByteSpan destination{reinterpret_cast<ByteType*>(&message), sizeof(TMessage)};
+			if (Framer.Examine(destination)) return true;
+			return ReadIntoFramer() != 0 && Framer.Examine(destination);
+		}
+
+		/// @brief 获取指向分帧器解码缓冲区的数据包，不复制数据
+		///	@param frame 数据包所在的字节区间，在下一次获取前有效
+		[[nodiscard]] bool GetView(CByteSpan& frame) noexcept {
+			if (Framer.Next(frame)) return true;
+			return ReadIntoFramer() != 0 && Framer.Next(frame);
+		}
+	};
+
+	/// @brief 一批消息，作为批量传递时的物品类型
+	template <std::default_initializable TMessage, SizeType TCapacity>
+	struct MessageBatch {
+		using MessageType = TMessage;
+		static constexpr SizeType Capacity = TCapacity;
+
+		std::array<TMessage, TCapacity> Messages{};
+		SizeType Count{0};
+
+		[[nodiscard]] std::span<TMessage> ToSpan() noexcept { return {Messages.data(), Count}; }
+
+		[[nodiscard]] std::span<const TMessage> ToSpan() const noexcept { return {Messages.data(), Count}; }
+	};
+
+	/// @brief 支持批量获取物品的 @c ItemSource
+	template <typename TItemSource, typename TItem = typename TItemSource::ItemType>
+	concept IsBatchItemSource = IsItemSource<TItemSource> && requires(TItemSource& source, std::span<TItem> items) {
+		{ source.GetItems(items) } -> std::same_as<SizeType>;
+	};
+
+	/// @brief 支持获取指向内部缓冲区的消息的 @c ItemSource
+	template <typename TItemSource>
+	concept IsViewItemSource = IsItemSource<TItemSource> && requires(TItemSource& source, CByteSpan& frame) {
+		{ source.GetView(frame) } -> std::convertible_to<bool>;
+	};
+
+	/// @brief 支持一次接收一批物品的 @c ItemDestination
+	template <typename TItemDestination, typename TItem = typename TItemDestination::ItemType>
+	concept IsBatchItemDestination = IsItemDestination<TItemDestination> && requires(
+		TItemDestination& destination,
+		std::span<const TItem> items) {
+		destination.SetItems(items);
+	};
+
+	/// @brief 将支持批量获取的消息源包装为以 @c MessageBatch 为物品的消息源
+	template <IsBatchItemSource TMessageSource, SizeType TBatchSize>
+	class MessageSourceToBatchSourceAdapter final {
+		ObjectUser<TMessageSource> MessageSource{};
+
+		struct Configurations {
+			struct ActorsType {
+				ObjectUser<TMessageSource>& MessageSource;
+			} Actors;
+		};
+
+	public:
+		using MessageType = typename TMessageSource::ItemType;
+		using ItemType = MessageBatch<MessageType, TBatchSize>;
+
+		[[nodiscard]] Configurations Configure() noexcept { return {.Actors = {MessageSource}}; }
+
+		[[nodiscard]] bool IsFunctional() const noexcept { return ValidateAll(MessageSource); }
+
+		[[nodiscard]] bool GetItem(ItemType& batch) noexcept {
+			batch.Count = MessageSource->GetItems(std::span{batch.Messages});
+			return batch.Count != 0;
+		}
+	};
+
+	/// @brief 将支持 @c GetView 的消息源包装为以 @c CByteSpan 为物品的消息源，消息目标可以通过 @c ViewAs 原地解析消息
+	///	@note 输出的区间在下一次 @c GetItem 前有效
+	template <IsViewItemSource TMessageSource>
+	class MessageSourceToViewSourceAdapter final {
+		ObjectUser<TMessageSource> MessageSource{};
+
+		struct Configurations {
+			struct ActorsType {
+				ObjectUser<TMessageSource>& MessageSource;
+			} Actors;
+		};
+
+	public:
+		using MessageType = typename TMessageSource::ItemType;
+		using ItemType = CByteSpan;
+
+		[[nodiscard]] Configurations Configure() noexcept { return {.Actors = {MessageSource}}; }
+
+		[[nodiscard]] bool IsFunctional() const noexcept { return ValidateAll(MessageSource); }
+
+		[[nodiscard]] bool GetItem(CByteSpan& frame) noexcept { return MessageSource->GetView(frame); }
+	};
+
+	/// @brief 将一批消息交给消息目标
+	///	@details 如果消息目标满足 @c IsBatchItemDestination ，整批消息通过一次 @c SetItems 调用交出，否则逐个调用 @c SetItem
+	template <IsItemDestination TMessageDestination, SizeType TBatchSize>
+	class BatchToMessageDestinationAdapter final {
+		Credential<TMessageDestination> MessageDestination{};
+
+		struct Configurations {
+			struct ActorsType {
+				Credential<TMessageDestination>& MessageDestination;
+			} Actors;
+		};
+
+	public:
+		using MessageType = typename TMessageDestination::ItemType;
+		using ItemType = MessageBatch<MessageType, TBatchSize>;
+
+		[[nodiscard]] Configurations Configure() noexcept { return {.Actors = {MessageDestination}}; }
+
+		[[nodiscard]] bool IsFunctional() const noexcept { return Validate(MessageDestination); }
+
+		void SetItem(const ItemType& batch) noexcept {
+			const auto destination_user = MessageDestination.lock();
+			if (!destination_user) return;
+
+			if constexpr (IsBatchItemDestination<TMessageDestination>)
+				destination_user->SetItems(batch.ToSpan());
+			else
+				for (const auto& message : batch.ToSpan()) destination_user->SetItem(message);
+		}
+	};
+
+	/// @brief 以批量方式传递消息的 @c DeliveryTaskAsReaderConsumer
+	///	@details 读取器通过 @c StreamReaderToMessageSourceAdapter 分帧，每次任务循环将缓冲区中所有消息(最多 TBatchSize 个)一次交给消息目标
+	template <
+		IsReader TReader,
+		IsVerifier TVerifier,
+		IsItemDestination TMessageDestination,
+		IsDeliveryTaskMonitor TTaskMonitor,
+		SizeType TBatchSize = 16,
+		std::default_initializable TMessage = typename TMessageDestination::ItemType>
+	class DeliveryTaskAsBatchReaderConsumer final {
+		using AdapterType = StreamReaderToMessageSourceAdapter<TReader, TMessage, TVerifier>;
+		using SourceType = MessageSourceToBatchSourceAdapter<AdapterType, TBatchSize>;
+		using DestinationType = BatchToMessageDestinationAdapter<TMessageDestination, TBatchSize>;
+
+		Owner<AdapterType> AdapterOwner{};
+		Owner<SourceType> SourceOwner{};
+		Owner<DestinationType> DestinationOwner{};
+		DeliveryTask<SourceType, DestinationType, TTaskMonitor> Task{};
+
+		struct Configurations {
+			struct ActorsType {
+				Credential<TMessageDestination>& MessageDestination;
+				Credential<TTaskMonitor>& Monitor;
+				ObjectUser<ConnectionCounters>& Counters;
+			} Actors;
+
+			struct OptionsType {
+				ByteType& HeadByte;
+				TVerifier& Verifier;
+				SizeType& ReadSize;
+				std::chrono::milliseconds& MinInterval;
+			} Options;
+		};
+
+	public:
+		using ItemType = ObjectUser<TReader>;
+
+		DeliveryTaskAsBatchReaderConsumer() noexcept {
+			SourceOwner->Configure().Actors.MessageSource = AdapterOwner;
 			const auto actors = Task.Configure().Actors;
-			return Validate(actors.ItemDestination, actors.Monitor);
+			actors.ItemSource = SourceOwner;
+			actors.ItemDestination = DestinationOwner;
+		}
+
+		[[nodiscard]] Configurations Configure() noexcept {
+			auto&& adapter = AdapterOwner->Configure();
+			auto&& delivery = Task.Configure();
+			return {
+				.Actors = {
+					DestinationOwner->Configure().Actors.MessageDestination,
+					delivery.Actors.Monitor,
+					adapter.Actors.Counters
+				},
+				.Options = {
+					adapter.Options.HeadByte,
+					adapter.Options.Verifier,
+					adapter.Options.ReadSize,
+					delivery.Options.MinInterval
+				}
+			};
+		}
+
+		[[nodiscard]] bool IsFunctional() noexcept {
+			return DestinationOwner->IsFunctional() && Validate(Task.Configure().Actors.Monitor);
 		}
 
 		void SetItem(const ObjectUser<TReader>& reader) noexcept {
@@ -143,25 +679,71 @@ namespace Cango :: inline ByteCommunication :: inline Core {
 		}
 	};
 
+	/// @brief 写入前对字节进行字节填充编码的写入器，每次 @c WriteBytes 写入的字节编码为一个数据包
+	///	@details 与 @c DelimitedReaderToMessageSourceAdapter 配合使用，可以作为 @c WriterToMessageDestinationAdapter 的写入器
+	template <IsWriter TWriter, IsByteStuffingCodec TCodec, SizeType TMaxFrameSize>
+	class StuffingWriter final {
+		ObjectUser<TWriter> Writer{};
+		std::array<ByteType, TCodec::MaxEncodedSize(TMaxFrameSize)> Encoded{};
+
+		struct Configurations {
+			struct ActorsType {
+				ObjectUser<TWriter>& Writer;
+			} Actors;
+		};
+
+	public:
+		using WriterType = TWriter;
+		using CodecType = TCodec;
+
+		[[nodiscard]] Configurations Configure() noexcept { return {.Actors = {Writer}}; }
+
+		[[nodiscard]] bool IsFunctional() const noexcept { return ValidateAll(Writer); }
+
+		/// @brief 编码并写入一个数据包
+		///	@return 编码后的数据全部写入时返回 buffer.size()，否则返回 0
+		[[nodiscard]] SizeType WriteBytes(const CByteSpan buffer) noexcept {
+			if (buffer.size() > TMaxFrameSize) return 0;
+			const auto size = TCodec::Encode(buffer, Encoded);
+			return Writer->WriteBytes(CByteSpan{Encoded.data(), size}) == size ? buffer.size() : 0;
+		}
+	};
+
+	/// @brief 消息在写入时表示的字节，如果消息提供 @c ToSpan (如 @c VariableFrame )，则只包含其表示的字节
+	template <typename TMessage>
+	[[nodiscard]] CByteSpan MessageToBytes(const TMessage& message) noexcept {
+		if constexpr (requires { { message.ToSpan() } -> std::same_as<CByteSpan>; }) return message.ToSpan();
+		else return CByteSpan{reinterpret_cast<const ByteType*>(&message), sizeof(TMessage)};
+	}
+
+	/// @brief 将消息写入写入器的消息目标
+	///	@details 启用 @c IsLatencyHistogramEnabled 时，将每次写入的耗时记录到 Latencies
 	template <IsWriter TWriter, std::default_initializable TMessage>
 	class WriterToMessageDestinationAdapter final {
 		ObjectUser<TWriter> Writer{};
+		[[no_unique_address]] PipelineLatencyRecorder Latencies{};
+		ObjectUser<ConnectionCounters> Counters{};
 
 		struct Configurations {
 			struct ActorsType {
 				ObjectUser<TWriter>& Writer;
+				PipelineLatencyRecorder& Latencies;
+				ObjectUser<ConnectionCounters>& Counters;
 			} Actors;
 		};
 
 	public:
-		[[nodiscard]] Configurations Configure() noexcept { return {.Actors = {Writer}}; }
+		[[nodiscard]] Configurations Configure() noexcept { return {.Actors = {Writer, Latencies, Counters}}; }
 
 		[[nodiscard]] bool IsFunctional() const noexcept { return ValidateAll(Writer); }
 
 		using ItemType = TMessage;
 
+		/// @brief 写入消息，见 @c MessageToBytes
 		void SetItem(const TMessage& message) noexcept {
-			(void)Writer->WriteBytes(CByteSpan{reinterpret_cast<const ByteType*>(&message), sizeof(TMessage)});
+			LatencyScope scope{Latencies, &PipelineLatencies::Write};
+			const auto bytes = Writer->WriteBytes(MessageToBytes(message));
+			if (Counters) Counters->BytesWritten.Add(bytes);
 		}
 	};
 
@@ -180,6 +762,8 @@ namespace Cango :: inline ByteCommunication :: inline Core {
 			struct ActorsType {
 				Credential<TMessageSource>& MessageSource;
 				Credential<TTaskMonitor>& Monitor;
+				PipelineLatencyRecorder& Latencies;
+				ObjectUser<ConnectionCounters>& Counters;
 			} Actors;
 
 			struct OptionsType {
@@ -192,10 +776,13 @@ namespace Cango :: inline ByteCommunication :: inline Core {
 
 		[[nodiscard]] Configurations Configure() noexcept {
 			auto&& delivery = Task.Configure();
+			auto&& transformer = Transformer->Configure();
 			return {
 				.Actors = {
 					delivery.Actors.ItemSource,
-					delivery.Actors.Monitor
+					delivery.Actors.Monitor,
+					transformer.Actors.Latencies,
+					transformer.Actors.Counters
 				},
 				.Options = {
 					delivery.Options.MinInterval
@@ -214,26 +801,286 @@ namespace Cango :: inline ByteCommunication :: inline Core {
 			const auto monitor_user = Task.Configure().Actors.Monitor.lock();
 			if (!monitor_user || !writer) return;
 
+			monitor_user->Reset();
+			Execute(writer);
+		}
+
+		/// @brief 向写入器写入消息，直到监视器被中断，不重置监视器
+		///	@details 用于由调用者统一重置监视器的场合，避免覆盖其他线程已经发出的中断
+		void Execute(const ObjectUser<TWriter>& writer) noexcept {
+			if (!writer) return;
 			Transformer->Configure().Actors.Writer = writer;
+			Task.Execute();
+		}
+	};
+
+	/// @brief 从消息源取出一批消息，作为 @c DeliveryTaskAsBatchWriterConsumer 的物品来源
+	///	@details
+	///		第一个消息使用 GetItem 获取，之后的消息在不等待的情况下尽量取出(消息源支持 TryGetItem 或 GetItems 时)，
+	///		直到取满 TBatchSize 个消息或消息的总字节数达到 MaxBatchBytes。
+	template <IsItemSource TMessageSource, SizeType TBatchSize>
+	class MessageSourceToWriteBatchSourceAdapter final {
+		using MessageType = typename TMessageSource::ItemType;
+
+		Credential<TMessageSource> MessageSource{};
+		SizeType MaxBatchBytes{SizeType{1} << 16};
+
+		struct Configurations {
+			struct ActorsType {
+				Credential<TMessageSource>& MessageSource;
+			} Actors;
+
+			struct OptionsType {
+				SizeType& MaxBatchBytes;
+			} Options;
+		};
+
+		[[nodiscard]] static bool TryGetMessage(TMessageSource& source, MessageType& message) noexcept {
+			if constexpr (requires { { source.TryGetItem(message) } -> std::convertible_to<bool>; })
+				return source.TryGetItem(message);
+			else return source.GetItem(message);
+		}
+
+	public:
+		using ItemType = MessageBatch<MessageType, TBatchSize>;
+
+		[[nodiscard]] Configurations Configure() noexcept { return {.Actors = {MessageSource}, .Options = {MaxBatchBytes}}; }
+
+		[[nodiscard]] bool IsFunctional() const noexcept { return Validate(MessageSource); }
+
+		[[nodiscard]] bool GetItem(ItemType& batch) noexcept {
+			batch.Count = 0;
+			const auto source_user = MessageSource.lock();
+			if (!source_user || !source_user->GetItem(batch.Messages[0])) return false;
+
+			auto& source = *source_user;
+			SizeType bytes = MessageToBytes(batch.Messages[0]).size();
+			batch.Count = 1;
+			while (batch.Count < TBatchSize && bytes < MaxBatchBytes) {
+				if constexpr (IsBatchItemSource<TMessageSource>) {
+					// 消息表示的字节不超过消息对象的大小，按剩余的字节预算一次取出
+					const auto count = std::min(
+						TBatchSize - batch.Count,
+						std::max<SizeType>((MaxBatchBytes - bytes) / sizeof(MessageType), 1));
+					const auto taken = source.GetItems(std::span{batch.Messages}.subspan(batch.Count, count));
+					for (const auto& message : std::span{batch.Messages}.subspan(batch.Count, taken))
+						bytes += MessageToBytes(message).size();
+					batch.Count += taken;
+					if (taken < count) break;
+				}
+				else {
+					if (!TryGetMessage(source, batch.Messages[batch.Count])) break;
+					bytes += MessageToBytes(batch.Messages[batch.Count]).size();
+					++batch.Count;
+				}
+			}
+			return true;
+		}
+	};
+
+	/// @brief 将一批消息依次序列化到可重用的缓冲区，通过一次 WriteBytes 写入
+	template <IsWriter TWriter, std::default_initializable TMessage, SizeType TBatchSize>
+	class BatchToWriterAdapter final {
+		ObjectUser<TWriter> Writer{};
+		[[no_unique_address]] PipelineLatencyRecorder Latencies{};
+		ObjectUser<ConnectionCounters> Counters{};
+		std::vector<ByteType> Buffer{};
+
+		void Write(const CByteSpan bytes) noexcept {
+			LatencyScope scope{Latencies, &PipelineLatencies::Write};
+			const auto written = Writer->WriteBytes(bytes);
+			if (Counters) Counters->BytesWritten.Add(written);
+		}
+
+		struct Configurations {
+			struct ActorsType {
+				ObjectUser<TWriter>& Writer;
+				PipelineLatencyRecorder& Latencies;
+				ObjectUser<ConnectionCounters>& Counters;
+			} Actors;
+		};
+
+	public:
+		using ItemType = MessageBatch<TMessage, TBatchSize>;
+
+		[[nodiscard]] Configurations Configure() noexcept { return {.Actors = {Writer, Latencies, Counters}}; }
+
+		[[nodiscard]] bool IsFunctional() const noexcept { return ValidateAll(Writer); }
+
+		void SetItem(const ItemType& batch) noexcept {
+			if (batch.Count == 1) {
+				Write(MessageToBytes(batch.Messages[0]));
+				return;
+			}
+
+			Buffer.clear();
+			for (const auto& message : batch.ToSpan()) {
+				const auto bytes = MessageToBytes(message);
+				Buffer.insert(Buffer.end(), bytes.begin(), bytes.end());
+			}
+			Write(Buffer);
+		}
+	};
+
+	/// @brief 以批量方式写入消息的 @c DeliveryTaskAsWriterConsumer
+	///	@details
+	///		每次任务循环取出消息源中所有待发送的消息(最多 TBatchSize 个或 MaxBatchBytes 字节)，
+	///		连续序列化后通过一次 WriteBytes 写入，写入吞吐量不再受 MinInterval 限制。
+	///		见 @c MessageSourceToWriteBatchSourceAdapter
+	template <
+		IsWriter TWriter,
+		IsItemSource TMessageSource,
+		IsDeliveryTaskMonitor TTaskMonitor,
+		SizeType TBatchSize = 16,
+		std::default_initializable TMessage = typename TMessageSource::ItemType>
+	class DeliveryTaskAsBatchWriterConsumer final {
+		using SourceType = MessageSourceToWriteBatchSourceAdapter<TMessageSource, TBatchSize>;
+		using DestinationType = BatchToWriterAdapter<TWriter, TMessage, TBatchSize>;
+
+		Owner<SourceType> SourceOwner{};
+		Owner<DestinationType> DestinationOwner{};
+		DeliveryTask<SourceType, DestinationType, TTaskMonitor> Task{};
+
+		struct Configurations {
+			struct ActorsType {
+				Credential<TMessageSource>& MessageSource;
+				Credential<TTaskMonitor>& Monitor;
+				PipelineLatencyRecorder& Latencies;
+				ObjectUser<ConnectionCounters>& Counters;
+			} Actors;
+
+			struct OptionsType {
+				std::chrono::milliseconds& MinInterval;
+				SizeType& MaxBatchBytes;
+			} Options;
+		};
+
+	public:
+		DeliveryTaskAsBatchWriterConsumer() noexcept {
+			const auto actors = Task.Configure().Actors;
+			actors.ItemSource = SourceOwner;
+			actors.ItemDestination = DestinationOwner;
+		}
+
+		[[nodiscard]] Configurations Configure() noexcept {
+			auto&& source = SourceOwner->Configure();
+			auto&& destination = DestinationOwner->Configure();
+			auto&& delivery = Task.Configure();
+			return {
+				.Actors = {
+					source.Actors.MessageSource,
+					delivery.Actors.Monitor,
+					destination.Actors.Latencies,
+					destination.Actors.Counters
+				},
+				.Options = {
+					delivery.Options.MinInterval,
+					source.Options.MaxBatchBytes
+				}
+			};
+		}
+
+		bool IsFunctional() noexcept {
+			return SourceOwner->IsFunctional() && Validate(Task.Configure().Actors.Monitor);
+		}
+
+		using ItemType = ObjectUser<TWriter>;
+
+		void SetItem(const ObjectUser<TWriter>& writer) noexcept {
+			const auto monitor_user = Task.Configure().Actors.Monitor.lock();
+			if (!monitor_user || !writer) return;
+
 			monitor_user->Reset();
+			Execute(writer);
+		}
+
+		/// @brief 向写入器写入消息，直到监视器被中断，不重置监视器
+		void Execute(const ObjectUser<TWriter>& writer) noexcept {
+			if (!writer) return;
+			DestinationOwner->Configure().Actors.Writer = writer;
 			Task.Execute();
 		}
 	};
 
+	/// @brief 读写器的消费者，读取和写入分别在两个常驻线程上进行
+	///	@details
+	///		两个工作线程随对象创建，每次 SetItem 重置两个监视器后将读写器交给它们，直到两者都结束才返回；
+	///		任意一方结束时中断另一方的监视器。重新连接时不再创建和销毁线程。
+	///	@tparam TWriterBatchSize 大于 1 时使用 @c DeliveryTaskAsBatchWriterConsumer 写入，字节预算为默认值
 	template <
 		IsRWer TRWer,
 		IsVerifier TReaderMessageVerifier,
 		IsItemDestination TReaderMessageDestination,
 		IsItemSource TWriterMessageSource,
 		IsDeliveryTaskMonitor TReaderMonitor,
-		IsDeliveryTaskMonitor TWriterMonitor>
+		IsDeliveryTaskMonitor TWriterMonitor,
+		SizeType TWriterBatchSize = 1>
 	class DeliveryTaskAsRWerConsumer final {
 		using ReaderConsumerType = DeliveryTaskAsReaderConsumer<
 			TRWer, TReaderMessageVerifier, TReaderMessageDestination, TReaderMonitor>;
-		using WriterConsumerType = DeliveryTaskAsWriterConsumer<TRWer, TWriterMessageSource, TWriterMonitor>;
+		using WriterConsumerType = std::conditional_t<
+			(TWriterBatchSize > 1),
+			DeliveryTaskAsBatchWriterConsumer<TRWer, TWriterMessageSource, TWriterMonitor, TWriterBatchSize>,
+			DeliveryTaskAsWriterConsumer<TRWer, TWriterMessageSource, TWriterMonitor>>;
 
 		ReaderConsumerType ReaderConsumer{};
 		WriterConsumerType WriterConsumer{};
+		[[no_unique_address]] PipelineLatencyRecorder Latencies{};
+		ObjectUser<ConnectionCounters> Counters{};
+
+		std::mutex Mutex{};
+		std::condition_variable_any Condition{};
+		ObjectUser<TRWer> CurrentRWer{};
+		std::uint64_t Generation{0};
+		SizeType RunningCount{0};
+
+		/// @brief 工作线程的主循环，每当 Generation 变化时用新的读写器调用一次 function
+		template <typename TFunction>
+		void Work(const std::stop_token& token, const TFunction& function) noexcept {
+			std::uint64_t generation{0};
+			std::unique_lock lock{Mutex};
+			while (Condition.wait(lock, token, [this, &generation] { return Generation != generation; })) {
+				generation = Generation;
+				const auto rw_user = CurrentRWer;
+				lock.unlock();
+				function(rw_user);
+				lock.lock();
+				--RunningCount;
+				Condition.notify_all();
+			}
+		}
+
+		void Read(const ObjectUser<TRWer>& rw_user) noexcept {
+			ObjectUser<TWriterMonitor> writer_monitor_user = WriterConsumer.Configure().Actors.Monitor.lock();
+			if (!writer_monitor_user) return;
+			const auto actors = ReaderConsumer.Configure().Actors;
+			actors.Latencies = Latencies;
+			actors.Counters = Counters;
+			ReaderConsumer.Execute(rw_user);
+			writer_monitor_user->Interrupt();
+			WakeWriterMessageSource();
+		}
+
+		/// @brief 唤醒阻塞在写入消息源 GetItem 中的写入任务，使其立即看到中断，而不是等到消息源的等待超时
+		void WakeWriterMessageSource() noexcept {
+			if constexpr (requires(TWriterMessageSource& source) { source.Wake(); }) {
+				if (const auto source_user = WriterConsumer.Configure().Actors.MessageSource.lock()) source_user->Wake();
+			}
+		}
+
+		void Write(const ObjectUser<TRWer>& rw_user) noexcept {
+			ObjectUser<TReaderMonitor> reader_monitor_user = ReaderConsumer.Configure().Actors.Monitor.lock();
+			if (!reader_monitor_user) return;
+			const auto actors = WriterConsumer.Configure().Actors;
+			actors.Latencies = Latencies;
+			actors.Counters = Counters;
+			WriterConsumer.Execute(rw_user);
+			reader_monitor_user->Interrupt();
+		}
+
+		/// @brief 常驻的工作线程，必须在所有成员之后构造
+		std::jthread ReaderWorker{[this](const std::stop_token& token) { Work(token, [this](const auto& rw) { Read(rw); }); }};
+		std::jthread WriterWorker{[this](const std::stop_token& token) { Work(token, [this](const auto& rw) { Write(rw); }); }};
 
 		struct Configurations {
 			struct ActorsType {
@@ -241,6 +1088,10 @@ namespace Cango :: inline ByteCommunication :: inline Core {
 				Credential<TWriterMessageSource>& WriterMessageSource;
 				Credential<TReaderMonitor>& ReadingMonitor;
 				Credential<TWriterMonitor>& WritingMonitor;
+				/// @brief 读写两个方向共用的耗时记录，每次连接开始时交给读取和写入任务
+				PipelineLatencyRecorder& Latencies;
+				/// @brief 读写两个方向共用的计数器，与 Latencies 相同，每次连接开始时交给读取和写入任务
+				ObjectUser<ConnectionCounters>& Counters;
 			} Actors;
 
 			struct OptionsType {
@@ -262,7 +1113,9 @@ namespace Cango :: inline ByteCommunication :: inline Core {
 					reader.Actors.MessageDestination,
 					writer.Actors.MessageSource,
 					reader.Actors.Monitor,
-					writer.Actors.Monitor
+					writer.Actors.Monitor,
+					Latencies,
+					Counters
 				},
 				.Options = {
 					reader.Options.HeadByte,
@@ -281,32 +1134,27 @@ namespace Cango :: inline ByteCommunication :: inline Core {
 
 		void SetItem(const Owner<TRWer>& rw) noexcept {
 			const ObjectUser<TRWer> rw_user{rw};
-			if (!rw_user) return;
-
-			std::thread reader_thread{
-				[this, rw_user] {
-					ObjectUser<TWriterMonitor> writer_monitor_user = WriterConsumer.Configure().Actors.Monitor.lock();
-					if (!writer_monitor_user) return;
-					auto& writer_monitor = *writer_monitor_user;
-					ReaderConsumer.SetItem(rw_user);
-					writer_monitor.Interrupt();
-				}
-			};
-			std::thread writer_thread{
-				[this, rw_user] {
-					ObjectUser<TReaderMonitor> reader_monitor_user = ReaderConsumer.Configure().Actors.Monitor.lock();
-					if (!reader_monitor_user) return;
-					auto& reader_monitor = *reader_monitor_user;
-					WriterConsumer.SetItem(rw_user);
-					reader_monitor.Interrupt();
-				}
-			};
-			reader_thread.join();
-			writer_thread.join();
+			const auto reader_monitor_user = ReaderConsumer.Configure().Actors.Monitor.lock();
+			const auto writer_monitor_user = WriterConsumer.Configure().Actors.Monitor.lock();
+			if (!rw_user || !reader_monitor_user || !writer_monitor_user) return;
+
+			// 在交给工作线程前重置监视器，先结束的一方发出的中断不会被另一方的重置覆盖
+			reader_monitor_user->Reset();
+			writer_monitor_user->Reset();
+
+			std::unique_lock lock{Mutex};
+			if (Counters && Generation != 0) Counters->Reconnects.Add();
+			CurrentRWer = rw_user;
+			RunningCount = 2;
+			++Generation;
+			Condition.notify_all();
+			Condition.wait(lock, [this] { return RunningCount == 0; });
+			CurrentRWer.reset();
 		}
 	};
 
 	/// @brief 单设备获取、通信任务
+	///	@tparam TWriterBatchSize 每次写入最多合并的消息数，见 @c DeliveryTaskAsBatchWriterConsumer
 	template <
 		IsRWerProvider TProvider,
 		IsDeliveryTaskMonitor TProviderMonitor,
@@ -314,7 +1162,8 @@ namespace Cango :: inline ByteCommunication :: inline Core {
 		IsItemDestination TReaderMessageDestination,
 		IsItemSource TWriterMessageSource,
 		IsDeliveryTaskMonitor TReaderMonitor,
-		IsDeliveryTaskMonitor TWriterMonitor>
+		IsDeliveryTaskMonitor TWriterMonitor,
+		SizeType TWriterBatchSize = 1>
 	class CommunicationTask {
 		using RWerConsumerType = DeliveryTaskAsRWerConsumer<
 			typename TProvider::ItemType::element_type,
@@ -322,7 +1171,8 @@ namespace Cango :: inline ByteCommunication :: inline Core {
 			TReaderMessageDestination,
 			TWriterMessageSource,
 			TReaderMonitor,
-			TWriterMonitor>;
+			TWriterMonitor,
+			TWriterBatchSize>;
 		using ProviderTaskType = DeliveryTask<TProvider, RWerConsumerType, TProviderMonitor>;
 
 		ProviderTaskType ProviderTask{};
@@ -336,6 +1186,10 @@ namespace Cango :: inline ByteCommunication :: inline Core {
 				Credential<TProviderMonitor>& ProviderMonitor;
 				Credential<TReaderMonitor>& ReaderMonitor;
 				Credential<TWriterMonitor>& WriterMonitor;
+				/// @brief 见 @c IsLatencyHistogramEnabled ，未启用时赋值不起作用
+				PipelineLatencyRecorder& Latencies;
+				/// @brief 见 @c ConnectionCounters ，为空时不计数
+				ObjectUser<ConnectionCounters>& Counters;
 			} Actors;
 
 			struct OptionsType {
@@ -368,7 +1222,9 @@ namespace Cango :: inline ByteCommunication :: inline Core {
 					consumer.Actors.WriterMessageSource,
 					provider.Actors.Monitor,
 					consumer.Actors.ReadingMonitor,
-					consumer.Actors.WritingMonitor
+					consumer.Actors.WritingMonitor,
+					consumer.Actors.Latencies,
+					consumer.Actors.Counters
 				},
 				.Options = {
 					consumer.Options.HeadByte,
@@ -392,29 +1248,51 @@ namespace Cango :: inline ByteCommunication :: inline Core {
 		}
 	};
 
+	/// @tparam TWriterMessagePool 写入消息池，使用 @c NotifyingItemPool 时应将 WriterMinInterval 设为 0
+	/// @tparam TReaderMessagePool 读取消息池，使用 @c SpscMessageQueue 可以保留突发到达的多个消息
+	/// @tparam TWriterBatchSize 大于 1 时将待发送的消息合并写入，写入消息池应能保存多个消息，如 @c MpscMessageQueue
 	template <
 		IsRWerProvider TProvider,
 		std::default_initializable TReaderMessage,
-		std::default_initializable TWriterMessage>
+		std::default_initializable TWriterMessage,
+		IsItemSource TWriterMessagePool = AsyncItemPool<TWriterMessage>,
+		IsItemDestination TReaderMessagePool = AsyncItemPool<TReaderMessage>,
+		SizeType TWriterBatchSize = 1>
 	using EasyCommunicationTask = CommunicationTask<
 		TProvider,
 		EasyDeliveryTaskMonitor,
 		TailZeroVerifier,
-		AsyncItemPool<TReaderMessage>,
-		AsyncItemPool<TWriterMessage>,
+		TReaderMessagePool,
+		TWriterMessagePool,
+		EasyDeliveryTaskMonitor,
 		EasyDeliveryTaskMonitor,
-		EasyDeliveryTaskMonitor>;
+		TWriterBatchSize>;
 
-	template <std::default_initializable TReaderMessage, std::default_initializable TWriterMessage>
+	/// @brief @c EasyCommunicationTask 使用的消息池和监视器
+	///	@details
+	///		默认使用只保存最新消息的 @c AsyncItemPool 。
+	///		需要保留每个消息时，读取消息池可以选择 @c SpscMessageQueue ，写入消息池可以选择 @c MpscMessageQueue ，
+	///		队列已满时的处理方式通过它们的 Configure().Options.Policy 设置。
+	template <
+		std::default_initializable TReaderMessage,
+		std::default_initializable TWriterMessage,
+		IsItemSource TWriterMessagePool = AsyncItemPool<TWriterMessage>,
+		IsItemDestination TReaderMessagePool = AsyncItemPool<TReaderMessage>>
 	struct EasyCommunicationTaskPoolsAndMonitors {
-		Owner<AsyncItemPool<TReaderMessage>> ReaderMessagePool{};
-		Owner<AsyncItemPool<TWriterMessage>> WriterMessagePool{};
+		Owner<TReaderMessagePool> ReaderMessagePool{};
+		Owner<TWriterMessagePool> WriterMessagePool{};
 		Owner<EasyDeliveryTaskMonitor> ProviderMonitor{};
 		Owner<EasyDeliveryTaskMonitor> ReaderMonitor{};
 		Owner<EasyDeliveryTaskMonitor> WriterMonitor{};
 
-		template <IsRWerProvider TProvider>
-		void Apply(EasyCommunicationTask<TProvider, TReaderMessage, TWriterMessage>& task) noexcept {
+		/// @brief 将消息池和监视器配置到任务中
+		///	@tparam TTask @c EasyCommunicationTask 或其他具有相同 Actors 的任务，如异步通信任务
+		template <typename TTask>
+		requires requires(TTask& task) {
+			task.Configure().Actors.ReaderMessageDestination = Owner<TReaderMessagePool>{};
+			task.Configure().Actors.WriterMessageSource = Owner<TWriterMessagePool>{};
+		}
+		void Apply(TTask& task) noexcept {
 			auto&& config = task.Configure();
 			const auto actors = config.Actors;
 			actors.ReaderMessageDestination = ReaderMessagePool;
@@ -1,8 +1,14 @@
 #pragma once
 
+#include <algorithm>
 #include <stdexcept>
 #include <ranges>
+#include <span>
 
+#include <Cango/CommonUtils/ObjectOwnership.hpp>
+
+#include "ByteSearch.hpp"
+#include "ConnectionStatistics.hpp"
 #include "Verifier.hpp"
 
 namespace Cango :: inline ByteCommunication {
@@ -22,10 +28,39 @@ namespace Cango :: inline ByteCommunication {
 		/// @brief 优化函数 @c FillPingWith0 ，避免重复清空 PingSpan
 		bool IsLastMessageFoundInPongSpan{false};
 
+		/// @brief 是否有尚未完成的 Pong 到 Ping 的复制，见 @c ExamineView
+		bool IsExchangePending{false};
+
+		/// @brief 上一个数据包在 FullSpan 中的位置，位置改变时记为一次重新同步
+		SizeType LastFrameOffset{0};
+
+		void CountFrame(const CByteSpan frame) noexcept {
+			const auto offset = static_cast<SizeType>(frame.data() - FullSpan.data());
+			if (!Counters) {
+				LastFrameOffset = offset;
+				return;
+			}
+			Counters->FramesEmitted.Add();
+			if (offset != LastFrameOffset) Counters->Resyncs.Add();
+			LastFrameOffset = offset;
+		}
+
+		/// @brief 在 PingSpan 中查找所有头字节候选，依次检验以其开头的数据包，直到找到第一个完整的数据包
+		///	@details 以 PongSpan 开头的候选已在 @c Examine 中检验过，其余位置开头的数据包无法完整落在缓冲区内，故只查找 PingSpan
 		[[nodiscard]] bool FindMessageSpan(CByteSpan& span) noexcept {
-			const auto head_index = std::ranges::find(PingSpan, HeadByte);
-			if (head_index == PingSpan.end()) return false;
-			span = FullSpan.subspan(head_index - PingSpan.begin(), PingSpan.size());
+			const auto size = PingSpan.size();
+			const CByteSpan full{FullSpan};
+			const auto head_index = FindEachByte(
+				PingSpan,
+				HeadByte,
+				[this, full, size](const SizeType index) {
+					if (Verifier.Verify(full.subspan(index, size))) return true;
+					if (Counters && index != 0) Counters->VerifyRejects.Add(); // 以 PingSpan 开头的候选在上一次检验时已经计数
+					return false;
+				}
+			);
+			if (head_index == size) return false;
+			span = full.subspan(head_index, size);
 			return true;
 		}
 
@@ -38,10 +73,14 @@ namespace Cango :: inline ByteCommunication {
 		ByteSpan FullSpan;
 		TVerifier Verifier{};
 
+		/// @brief 记录输出的数据包、重新同步和检验失败的次数，为空时不记录
+		ObjectUser<ConnectionCounters> Counters{};
+
 		/// @brief 给定头字节和完整的内存区间，构造 @c PingPongExchanger
 		///	@param fullSpan size 至少大于 2，否则会抛出 @c std::runtime_error
 		/// @exception std::runtime_error 当给定的参数不符合要求时抛出异常
 		explicit PingPongSpan(const ByteSpan fullSpan) :
+			LastFrameOffset(fullSpan.size() / 2),
 			PingSpan(fullSpan.data(), fullSpan.size() / 2),
 			PongSpan(fullSpan.data() + PingSpan.size(), PingSpan.size()),
 			FullSpan(fullSpan) {
@@ -49,28 +88,56 @@ namespace Cango :: inline ByteCommunication {
 			std::ranges::fill(PingSpan, 0);
 		}
 
-		/// @brief 假设已经写入所有数据到读取缓冲区(即 Pong 缓冲区)，现在执行交换流程，并检查是否可以输出
-		///	@param destination 用于输出数据的位置，大小必须大于或等于 @c PongSpan.size()
-		[[nodiscard]] bool Examine(ByteSpan destination) noexcept {
-			if (destination.size() < PingSpan.size()) return false;
-
+		/// @brief 假设已经写入所有数据到读取缓冲区(即 Pong 缓冲区)，检查是否可以输出，但不复制数据包
+		///	@param frame 指向内部缓冲区的数据包，在下一次调用 @c PrepareNextRead 前有效
+		///	@note 使用此函数时，每次写入 PongSpan 前必须调用 @c PrepareNextRead 完成交换流程
+		[[nodiscard]] bool ExamineView(CByteSpan& frame) noexcept {
 			// 如果 PongSpan 中有完整的数据包，则直接输出
 			if (Verify(PongSpan)) {
-				std::ranges::copy(PongSpan, destination.begin());
+				frame = PongSpan;
 				if (!IsLastMessageFoundInPongSpan) {
 					IsLastMessageFoundInPongSpan = true;
 					std::ranges::fill(PingSpan, 0);
 				}
+				CountFrame(frame);
 				return true;
 			}
+			if (Counters && PongSpan.front() == HeadByte) Counters->VerifyRejects.Add();
 
 			IsLastMessageFoundInPongSpan = false;
+			IsExchangePending = true; // 无论成功与否，都需要利用新数据覆盖 PingSpan
+			if (!FindMessageSpan(frame)) return false;
+			CountFrame(frame);
+			return true;
+		}
+
+		/// @brief 完成上一次 @c ExamineView 推迟的交换流程，之后可以向 PongSpan 写入新数据
+		void PrepareNextRead() noexcept {
+			if (!IsExchangePending) return;
+			std::ranges::copy(PongSpan, PingSpan.begin());
+			IsExchangePending = false;
+		}
+
+		/// @brief 假设已经写入所有数据到读取缓冲区(即 Pong 缓冲区)，现在执行交换流程，并检查是否可以输出
+		///	@param destination 用于输出数据的位置，大小必须大于或等于 @c PongSpan.size()
+		[[nodiscard]] bool Examine(ByteSpan destination) noexcept {
+			if (destination.size() < PingSpan.size()) return false;
+
 			CByteSpan message_span;
-			const auto successful = FindMessageSpan(message_span) && Verify(message_span);
+			const auto successful = ExamineView(message_span);
 			if (successful) std::ranges::copy(message_span, destination.begin());
-			std::ranges::copy(PongSpan, PingSpan.begin()); // 无论成功与否，都利用新数据覆盖 PingSpan
+			PrepareNextRead();
 			return successful;
 		}
+
+		/// @brief 与 @c RingFramer::ExamineAll 对应的批量接口
+		///	@note 除 PongSpan 本身外，新的数据包必须跨越 Ping 和 Pong，两者不能同时成立，所以最多输出一个数据包
+		///	@return 输出的数据包数量
+		template <typename TMessage>
+		[[nodiscard]] SizeType ExamineAll(const std::span<TMessage> destination) noexcept {
+			if (destination.empty()) return 0;
+			return Examine(ByteSpan{reinterpret_cast<ByteType*>(destination.data()), sizeof(TMessage)}) ? 1 : 0;
+		}
 	};
 
 	template <typename TMessage>
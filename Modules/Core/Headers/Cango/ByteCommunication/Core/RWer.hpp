@@ -1,5 +1,8 @@
 #pragma once
 
+#include <chrono>
+#include <span>
+
 #include "ByteTypes.hpp"
 
 namespace Cango:: inline ByteCommunication :: inline Core {
@@ -19,12 +22,95 @@ namespace Cango:: inline ByteCommunication :: inline Core {
 	template <typename TObject>
 	concept IsRWer = IsReader<TObject> && IsWriter<TObject>;
 
+	/// @brief 读取操作的等待时间
+	using TimeoutType = std::chrono::nanoseconds;
+
+	/// @brief 表示一直等待，直到有字节可读
+	inline constexpr TimeoutType NoTimeout = TimeoutType::max();
+
+	/// @brief 可以只读取当前可用字节的 @c Reader
+	///	@details
+	///		ReadSome 在至少读到一个字节后立即返回，最多填满缓冲区，不等待缓冲区填满；
+	///		超过等待时间仍然没有字节可读时返回 0。
+	///		不满足此概念的读取器不能以 ReadBytes 代替，否则会等待整个缓冲区填满，应由调用者决定每次读取的长度，见 @c ReadIntoFramer
+	template <typename TObject>
+	concept IsPartialReader = IsReader<TObject> && requires(TObject& object, ByteSpan buffer, TimeoutType timeout) {
+		{ object.ReadSome(buffer, timeout) } -> std::same_as<SizeType>;
+	};
+
+	/// @brief 一组不连续的可写字节区间，用于分散读取
+	using ByteSpans = std::span<const ByteSpan>;
+
+	/// @brief 一组不连续的只读字节区间，用于聚集写入
+	using CByteSpans = std::span<const CByteSpan>;
+
+	/// @brief 支持分散读取的 @c Reader ，一次调用依次填满多个缓冲区
+	template <typename TObject>
+	concept IsVectoredReader = IsReader<TObject> && requires(TObject& object, ByteSpans buffers) {
+		{ object.ReadBytesV(buffers) } -> std::same_as<SizeType>;
+	};
+
+	/// @brief 支持聚集写入的 @c Writer ，一次调用依次写入多个缓冲区
+	template <typename TObject>
+	concept IsVectoredWriter = IsWriter<TObject> && requires(TObject& object, CByteSpans buffers) {
+		{ object.WriteBytesV(buffers) } -> std::same_as<SizeType>;
+	};
+
+	/// @brief 依次读取字节到多个缓冲区
+	///	@details 读取器不支持分散读取时逐个调用 ReadBytes，遇到读取不足时停止
+	///	@return 实际读取的总字节数
+	template <IsReader TReader>
+	[[nodiscard]] SizeType ReadBytesV(TReader& reader, const ByteSpans buffers) noexcept {
+		if constexpr (IsVectoredReader<TReader>) return reader.ReadBytesV(buffers);
+		else {
+			SizeType total{0};
+			for (const auto buffer : buffers) {
+				const auto bytes = reader.ReadBytes(buffer);
+				total += bytes;
+				if (bytes < buffer.size()) break;
+			}
+			return total;
+		}
+	}
+
+	/// @brief 依次写入多个缓冲区中的字节
+	///	@details 写入器不支持聚集写入时逐个调用 WriteBytes，遇到写入不足时停止
+	///	@return 实际写入的总字节数
+	template <IsWriter TWriter>
+	[[nodiscard]] SizeType WriteBytesV(TWriter& writer, const CByteSpans buffers) noexcept {
+		if constexpr (IsVectoredWriter<TWriter>) return writer.WriteBytesV(buffers);
+		else {
+			SizeType total{0};
+			for (const auto buffer : buffers) {
+				const auto bytes = writer.WriteBytes(buffer);
+				total += bytes;
+				if (bytes < buffer.size()) break;
+			}
+			return total;
+		}
+	}
+
 	/// @brief 运行时确定的字节读取器
+	///	@note
+	///		不提供 ReadSome ，因此不满足 @c IsPartialReader 。以 ReadBytes 代替 ReadSome 会等待整个缓冲区填满，
+	///		分帧适配器将因此卡住；需要时请直接使用具体的读取器类型
 	struct RuntimeReader {
 		/// @brief 读取字节，直到无剩余内容或者提供的缓冲区已满
 		///	@return 实际读取的字节数，如果小于缓冲区长度，则可以认为遇到了一些错误，如 EOF 或者读取器不再可用
 		[[nodiscard]] virtual SizeType ReadBytes(ByteSpan buffer) = 0;
 
+		/// @brief 依次读取字节到多个缓冲区，默认逐个调用 @c ReadBytes
+		///	@return 实际读取的总字节数
+		[[nodiscard]] virtual SizeType ReadBytesV(const ByteSpans buffers) {
+			SizeType total{0};
+			for (const auto buffer : buffers) {
+				const auto bytes = ReadBytes(buffer);
+				total += bytes;
+				if (bytes < buffer.size()) break;
+			}
+			return total;
+		}
+
 		virtual ~RuntimeReader() = default;
 	};
 
@@ -34,6 +120,18 @@ namespace Cango:: inline ByteCommunication :: inline Core {
 		///	@return 实际写入的字节数，如果小于缓冲区长度，则可以认为遇到了一些错误，如写入器不再可用
 		[[nodiscard]] virtual SizeType WriteBytes(CByteSpan buffer) = 0;
 
+		/// @brief 依次写入多个缓冲区中的字节，默认逐个调用 @c WriteBytes
+		///	@return 实际写入的总字节数
+		[[nodiscard]] virtual SizeType WriteBytesV(const CByteSpans buffers) {
+			SizeType total{0};
+			for (const auto buffer : buffers) {
+				const auto bytes = WriteBytes(buffer);
+				total += bytes;
+				if (bytes < buffer.size()) break;
+			}
+			return total;
+		}
+
 		virtual ~RuntimeWriter() = default;
 	};
 
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <span>
+
+#include <Cango/CommonUtils/ObjectOwnership.hpp>
+
+#include "ByteSearch.hpp"
+#include "ConnectionStatistics.hpp"
+#include "Verifier.hpp"
+
+namespace Cango :: inline ByteCommunication :: inline Core {
+	/// @brief 容量为 2 的幂的环形字节缓冲区，末尾额外保留 TMirrorSize 字节作为缓冲区开头的镜像
+	///	@details
+	///		从任意位置开始、长度不超过 TMirrorSize + 1 的区间都可以连续访问，
+	///		这样跨越环形边界的数据包也能以连续的 @c CByteSpan 交给检验器，读写过程中不需要移动内存。
+	template <SizeType TCapacity, SizeType TMirrorSize>
+	requires (std::has_single_bit(TCapacity) && TMirrorSize < TCapacity)
+	class RingByteBuffer final {
+		static constexpr SizeType Mask = TCapacity - 1;
+
+		std::array<ByteType, TCapacity + TMirrorSize> Storage{};
+
+		/// @brief 读写位置只增不减，取余后得到缓冲区中的下标
+		SizeType ReadIndex{0};
+		SizeType WriteIndex{0};
+
+	public:
+		static constexpr SizeType Capacity = TCapacity;
+
+		/// @brief 缓冲区中尚未取出的字节数
+		[[nodiscard]] SizeType Size() const noexcept { return WriteIndex - ReadIndex; }
+
+		/// @brief 缓冲区剩余可写入的字节数
+		[[nodiscard]] SizeType FreeSize() const noexcept { return TCapacity - Size(); }
+
+		/// @brief 从读取位置偏移 offset 处开始，不跨越环形边界时可以连续访问的字节数
+		[[nodiscard]] SizeType ContiguousSize(const SizeType offset = 0) const noexcept {
+			return std::min(Size() - offset, TCapacity - ((ReadIndex + offset) & Mask));
+		}
+
+		/// @brief 获取从读取位置偏移 offset 处开始的连续区间
+		///	@param size 区间长度，不能超出未取出的字节，区间跨越环形边界时不能超过 TMirrorSize + 1
+		[[nodiscard]] CByteSpan Peek(const SizeType offset, const SizeType size) const noexcept {
+			return {Storage.data() + ((ReadIndex + offset) & Mask), size};
+		}
+
+		/// @brief 丢弃读取位置开始的 count 个字节
+		void Discard(const SizeType count) noexcept { ReadIndex += count; }
+
+		/// @brief 获取可直接写入的连续内存，写入后需要调用 @c Commit 提交
+		///	@note 区间可能因为环形边界而小于 @c FreeSize ，提交后再次获取即可得到剩余部分
+		[[nodiscard]] ByteSpan WritableSpan() noexcept {
+			const auto position = WriteIndex & Mask;
+			return {Storage.data() + position, std::min(FreeSize(), TCapacity - position)};
+		}
+
+		/// @brief 提交通过 @c WritableSpan 写入的字节
+		///	@param count 写入的字节数，不能超过 @c WritableSpan 的大小
+		void Commit(const SizeType count) noexcept {
+			const auto position = WriteIndex & Mask;
+			if (position < TMirrorSize) {
+				const auto mirrored = std::min(count, TMirrorSize - position);
+				std::copy_n(Storage.data() + position, mirrored, Storage.data() + TCapacity + position);
+			}
+			WriteIndex += count;
+		}
+
+		/// @brief 复制字节到缓冲区，直到字节全部写入或缓冲区已满
+		///	@return 实际写入的字节数
+		SizeType Write(CByteSpan bytes) noexcept {
+			SizeType total{0};
+			while (!bytes.empty()) {
+				const auto span = WritableSpan();
+				if (span.empty()) break;
+				const auto count = std::min(span.size(), bytes.size());
+				std::copy_n(bytes.data(), count, span.data());
+				Commit(count);
+				bytes = bytes.subspan(count);
+				total += count;
+			}
+			return total;
+		}
+	};
+
+	/// @brief 基于环形缓冲区的定长数据包分帧器。
+	///		每次可以写入任意数量的字节(1 字节到一次突发的全部数据)，然后依次取出缓冲区中所有完整且通过检验的数据包。
+	///	@details 数据存放在 @c RingByteBuffer 中，读写过程中不需要移动内存
+	///	@tparam TVerifier 用于检验数据包是否符合要求
+	///	@tparam TFrameSize 数据包大小
+	///	@tparam TCapacity 缓冲区容量，必须是 2 的幂，且不小于数据包大小
+	template <IsVerifier TVerifier, SizeType TFrameSize, SizeType TCapacity = SizeType{1} << 17>
+	requires (TFrameSize > 0 && std::has_single_bit(TCapacity) && TFrameSize <= TCapacity)
+	class RingFramer final {
+		RingByteBuffer<TCapacity, TFrameSize - 1> Buffer{};
+
+		/// @brief 上一个数据包之后丢弃过字节，输出下一个数据包时记为一次重新同步
+		bool IsResyncPending{false};
+
+	public:
+		using VerifierType = TVerifier;
+		static constexpr SizeType FrameSize = TFrameSize;
+		static constexpr SizeType Capacity = TCapacity;
+
+		ByteType HeadByte{'!'};
+		TVerifier Verifier{};
+
+		/// @brief 记录输出的数据包、重新同步和检验失败的次数，为空时不记录
+		ObjectUser<ConnectionCounters> Counters{};
+
+		/// @brief 缓冲区中尚未取出的字节数
+		[[nodiscard]] SizeType Size() const noexcept { return Buffer.Size(); }
+
+		/// @brief 缓冲区剩余可写入的字节数
+		[[nodiscard]] SizeType FreeSize() const noexcept { return Buffer.FreeSize(); }
+
+		/// @copydoc RingByteBuffer::WritableSpan
+		[[nodiscard]] ByteSpan WritableSpan() noexcept { return Buffer.WritableSpan(); }
+
+		/// @copydoc RingByteBuffer::Commit
+		void Commit(const SizeType count) noexcept { Buffer.Commit(count); }
+
+		/// @copydoc RingByteBuffer::Write
+		SizeType Write(const CByteSpan bytes) noexcept { return Buffer.Write(bytes); }
+
+		/// @brief 取出下一个完整的数据包，头字节之前和未通过检验的字节将被丢弃
+		///	@param frame 指向缓冲区内部的数据包，在下一次写入前有效
+		///	@return 是否找到数据包，如果没有找到，缓冲区中只保留可能成为数据包开头的最后 TFrameSize - 1 个字节
+		[[nodiscard]] bool Next(CByteSpan& frame) noexcept {
+			while (Buffer.Size() >= TFrameSize) {
+				const auto candidates = std::min(Buffer.Size() - TFrameSize + 1, Buffer.ContiguousSize());
+				const auto offset = FindEachByte(
+					Buffer.Peek(0, candidates),
+					HeadByte,
+					[this](const SizeType index) {
+						if (Verifier.Verify(Buffer.Peek(index, TFrameSize))) return true;
+						if (Counters) Counters->VerifyRejects.Add();
+						return false;
+					}
+				);
+				if (offset == candidates) {
+					Buffer.Discard(candidates);
+					IsResyncPending = true;
+					continue;
+				}
+
+				frame = Buffer.Peek(offset, TFrameSize);
+				Buffer.Discard(offset + TFrameSize);
+				if (Counters) {
+					Counters->FramesEmitted.Add();
+					if (IsResyncPending || offset != 0) Counters->Resyncs.Add();
+				}
+				IsResyncPending = false;
+				return true;
+			}
+			return false;
+		}
+
+		/// @brief 取出下一个完整的数据包，并复制到目标位置
+		///	@param destination 用于输出数据的位置，大小必须大于或等于 TFrameSize
+		[[nodiscard]] bool Examine(const ByteSpan destination) noexcept {
+			if (destination.size() < TFrameSize) return false;
+			CByteSpan frame;
+			if (!Next(frame)) return false;
+			std::ranges::copy(frame, destination.begin());
+			return true;
+		}
+
+		/// @brief 取出缓冲区中所有完整的数据包，直到目标区间已满
+		///	@param destination 用于输出数据包的区间
+		///	@return 输出的数据包数量
+		template <typename TMessage>
+		requires (sizeof(TMessage) == TFrameSize)
+		[[nodiscard]] SizeType ExamineAll(const std::span<TMessage> destination) noexcept {
+			SizeType count{0};
+			CByteSpan frame;
+			while (count < destination.size() && Next(frame)) {
+				std::ranges::copy(frame, reinterpret_cast<ByteType*>(destination.data() + count));
+				++count;
+			}
+			return count;
+		}
+	};
+
+	template <typename TMessage, IsVerifier TVerifier, SizeType TCapacity = SizeType{1} << 17>
+	using MessageRingFramer = RingFramer<TVerifier, sizeof(TMessage), TCapacity>;
+}
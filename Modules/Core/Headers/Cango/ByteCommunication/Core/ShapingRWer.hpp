@@ -0,0 +1,271 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <thread>
+
+#include <Cango/CommonUtils/ObjectOwnership.hpp>
+
+#include "RWer.hpp"
+
+namespace Cango :: inline ByteCommunication :: inline Core {
+	/// @brief @c ShapingRWer 的统计数据快照
+	struct ShapingStatistics {
+		/// @brief 内部读写器读到的字节数
+		std::uint64_t ReadCount{0};
+
+		/// @brief 丢弃的字节数
+		std::uint64_t DroppedCount{0};
+
+		/// @brief 翻转了一个位的字节数
+		std::uint64_t FlippedCount{0};
+	};
+
+	/// @brief 模拟劣质链路的 @c RWer 装饰器，用于测量分帧和任务在丢失、损坏、延迟和限速下的表现
+	///	@details
+	///		读取时依次进行：按 MaxChunkSize 将读取拆分为随机大小的小块；每块等待 Latency 加 [0, Jitter] 的随机时间；
+	///		按令牌桶限制带宽；每个字节以 FlipProbability 的概率翻转一个随机位，以 DropProbability 的概率丢弃。
+	///		写入时只限制带宽，读写方向使用各自的令牌桶。
+	///		随机数由 Seed 初始化，相同的配置和输入得到相同的结果，修改 Seed 后调用 @c Reseed 生效；
+	///		修改 DropProbability 或 FlipProbability 后，下一次读取时按新的概率重新计算距下一次事件的字节数。
+	///	@note 只能由一个读取线程和一个写入线程同时使用，读取和写入的状态分开保存，各自只由对应的线程修改
+	template <IsRWer TRWer>
+	class ShapingRWer final {
+		/// @brief 令牌桶，允许欠账，欠账时等待令牌补足
+		struct TokenBucket {
+			double Tokens{0};
+			std::chrono::steady_clock::time_point LastTime{std::chrono::steady_clock::now()};
+
+			void Take(const SizeType bytes, const double rate, const SizeType burst) noexcept {
+				if (rate <= 0) return;
+				const auto now = std::chrono::steady_clock::now();
+				const auto elapsed = std::chrono::duration<double>(now - LastTime).count();
+				LastTime = now;
+				Tokens = std::min(Tokens + elapsed * rate, static_cast<double>(burst)) - static_cast<double>(bytes);
+				if (Tokens < 0) std::this_thread::sleep_for(std::chrono::duration<double>(-Tokens / rate));
+			}
+		};
+
+		ObjectUser<TRWer> RWer{};
+		double BytesPerSecond{0};
+		SizeType BurstSize{4096};
+		double DropProbability{0};
+		double FlipProbability{0};
+		std::chrono::microseconds Latency{0};
+		std::chrono::microseconds Jitter{0};
+		SizeType MaxChunkSize{0};
+		std::uint64_t Seed{0};
+
+		/// @brief 只由读取线程访问的状态
+		struct ReaderState {
+			std::mt19937_64 Random{};
+			std::uint64_t Generation{0};
+			SizeType NextDrop{0};
+			SizeType NextFlip{0};
+
+			/// @brief 计算 NextDrop 和 NextFlip 时使用的概率
+			double DropProbability{0};
+			double FlipProbability{0};
+
+			TokenBucket Bucket{};
+		};
+
+		/// @brief 只由写入线程访问的状态
+		struct WriterState {
+			std::uint64_t Generation{0};
+			TokenBucket Bucket{};
+		};
+
+		ReaderState Reading{};
+		WriterState Writing{};
+
+		/// @brief 每次 @c Reseed 递增，读取和写入线程发现变化后各自重置状态
+		std::atomic<std::uint64_t> Generation{1};
+
+		std::atomic<std::uint64_t> ReadCount{0};
+		std::atomic<std::uint64_t> DroppedCount{0};
+		std::atomic<std::uint64_t> FlippedCount{0};
+
+		struct Configurations {
+			struct ActorsType {
+				ObjectUser<TRWer>& RWer;
+			} Actors;
+
+			struct OptionsType {
+				/// @brief 带宽，为 0 时不限速
+				double& BytesPerSecond;
+				/// @brief 令牌桶容量，即允许的突发字节数
+				SizeType& BurstSize;
+				double& DropProbability;
+				double& FlipProbability;
+				std::chrono::microseconds& Latency;
+				std::chrono::microseconds& Jitter;
+				/// @brief 每块读取的最大字节数，为 0 时不拆分
+				SizeType& MaxChunkSize;
+				std::uint64_t& Seed;
+			} Options;
+		};
+
+		/// @brief 距下一次事件的字节数，服从几何分布
+		[[nodiscard]] SizeType NextDistance(const double probability) noexcept {
+			if (probability <= 0) return std::numeric_limits<SizeType>::max();
+			if (probability >= 1) return 0;
+			return std::geometric_distribution<SizeType>{probability}(Reading.Random);
+		}
+
+		/// @brief 读取前应用 @c Reseed 和概率的修改，只由读取线程调用
+		void PrepareRead() noexcept {
+			if (const auto generation = Generation.load(std::memory_order_acquire); Reading.Generation != generation) {
+				Reading.Random.seed(Seed);
+				Reading.Generation = generation;
+				Reading.Bucket = {};
+				Reading.DropProbability = DropProbability;
+				Reading.FlipProbability = FlipProbability;
+				Reading.NextDrop = NextDistance(DropProbability);
+				Reading.NextFlip = NextDistance(FlipProbability);
+				return;
+			}
+			if (Reading.DropProbability != DropProbability) {
+				Reading.DropProbability = DropProbability;
+				Reading.NextDrop = NextDistance(DropProbability);
+			}
+			if (Reading.FlipProbability != FlipProbability) {
+				Reading.FlipProbability = FlipProbability;
+				Reading.NextFlip = NextDistance(FlipProbability);
+			}
+		}
+
+		/// @brief 写入前应用 @c Reseed ，只由写入线程调用
+		void PrepareWrite() noexcept {
+			if (const auto generation = Generation.load(std::memory_order_acquire); Writing.Generation != generation) {
+				Writing.Generation = generation;
+				Writing.Bucket = {};
+			}
+		}
+
+		[[nodiscard]] SizeType NextChunkSize(const SizeType size) noexcept {
+			if (MaxChunkSize == 0 || size <= 1) return size;
+			return std::uniform_int_distribution<SizeType>{1, std::min(size, MaxChunkSize)}(Reading.Random);
+		}
+
+		void Delay() noexcept {
+			auto delay = Latency;
+			if (Jitter.count() > 0)
+				delay += std::chrono::microseconds{
+					std::uniform_int_distribution<std::chrono::microseconds::rep>{0, Jitter.count()}(Reading.Random)
+				};
+			if (delay.count() > 0) std::this_thread::sleep_for(delay);
+		}
+
+		/// @brief 在读到的字节上翻转和丢弃，剩余字节移动到区间开头
+		///	@return 剩余的字节数
+		[[nodiscard]] SizeType Corrupt(const ByteSpan bytes) noexcept {
+			ReadCount.fetch_add(bytes.size(), std::memory_order_relaxed);
+			auto& next_flip = Reading.NextFlip;
+			auto& next_drop = Reading.NextDrop;
+			if (next_flip >= bytes.size() && next_drop >= bytes.size()) {
+				next_flip -= bytes.size();
+				next_drop -= bytes.size();
+				return bytes.size();
+			}
+
+			SizeType kept = 0;
+			for (auto byte : bytes) {
+				if (next_flip == 0) {
+					byte ^= static_cast<ByteType>(1u << std::uniform_int_distribution<unsigned>{0, 7}(Reading.Random));
+					FlippedCount.fetch_add(1, std::memory_order_relaxed);
+					next_flip = NextDistance(Reading.FlipProbability);
+				}
+				else --next_flip;
+
+				if (next_drop == 0) {
+					DroppedCount.fetch_add(1, std::memory_order_relaxed);
+					next_drop = NextDistance(Reading.DropProbability);
+					continue;
+				}
+				--next_drop;
+				bytes[kept++] = byte;
+			}
+			return kept;
+		}
+
+		/// @brief 对内部读写器读到的一块字节进行延迟、限速和损坏
+		[[nodiscard]] SizeType Shape(const ByteSpan bytes) noexcept {
+			Delay();
+			Reading.Bucket.Take(bytes.size(), BytesPerSecond, BurstSize);
+			return Corrupt(bytes);
+		}
+
+	public:
+		using RWerType = TRWer;
+
+		[[nodiscard]] Configurations Configure() noexcept {
+			return {
+				.Actors = {RWer},
+				.Options = {
+					BytesPerSecond, BurstSize, DropProbability, FlipProbability, Latency, Jitter, MaxChunkSize, Seed
+				}
+			};
+		}
+
+		[[nodiscard]] bool IsFunctional() const noexcept { return ValidateAll(RWer); }
+
+		/// @brief 用 Seed 重新初始化随机数，清空令牌桶和统计数据，用于重复相同的测试
+		///	@details 可以由任意线程调用，随机数和令牌桶由读取和写入线程在下一次读写时各自重置
+		void Reseed() noexcept {
+			Generation.fetch_add(1, std::memory_order_release);
+			ReadCount.store(0, std::memory_order_relaxed);
+			DroppedCount.store(0, std::memory_order_relaxed);
+			FlippedCount.store(0, std::memory_order_relaxed);
+		}
+
+		/// @brief 读取字节，直到缓冲区填满或内部读写器读取不足
+		///	@details 被丢弃的字节由后续读取补足
+		[[nodiscard]] SizeType ReadBytes(const ByteSpan buffer) noexcept {
+			PrepareRead();
+			SizeType filled = 0;
+			while (filled < buffer.size()) {
+				const auto chunk = buffer.subspan(filled, NextChunkSize(buffer.size() - filled));
+				const auto bytes = RWer->ReadBytes(chunk);
+				if (bytes == 0) break;
+				filled += Shape(chunk.first(bytes));
+				if (bytes < chunk.size()) break;
+			}
+			return filled;
+		}
+
+		/// @brief 读取一块字节，最多 MaxChunkSize 个
+		///	@details 整块字节都被丢弃时继续读取，每次读取重新计算等待时间
+		[[nodiscard]] SizeType ReadSome(const ByteSpan buffer, const TimeoutType timeout) noexcept
+		requires IsPartialReader<TRWer> {
+			PrepareRead();
+			if (buffer.empty()) return 0;
+			while (true) {
+				const auto chunk = buffer.first(NextChunkSize(buffer.size()));
+				const auto bytes = RWer->ReadSome(chunk, timeout);
+				if (bytes == 0) return 0;
+				if (const auto kept = Shape(chunk.first(bytes)); kept != 0) return kept;
+			}
+		}
+
+		/// @brief 限速后写入所有字节
+		[[nodiscard]] SizeType WriteBytes(const CByteSpan buffer) noexcept {
+			PrepareWrite();
+			Writing.Bucket.Take(buffer.size(), BytesPerSecond, BurstSize);
+			return RWer->WriteBytes(buffer);
+		}
+
+		/// @brief 获取统计数据，不需要加锁
+		[[nodiscard]] ShapingStatistics GetStatistics() const noexcept {
+			return {
+				.ReadCount = ReadCount.load(std::memory_order_relaxed),
+				.DroppedCount = DroppedCount.load(std::memory_order_relaxed),
+				.FlippedCount = FlippedCount.load(std::memory_order_relaxed)
+			};
+		}
+	};
+}
@@ -5,6 +5,7 @@
 #include <concepts>
 
 #include "ByteTypes.hpp"
+#include "DataField.hpp"
 
 namespace Cango :: inline ByteCommunication :: inline Core {
 	/// @brief 为 TypedMessage 实现额外功能，包括数据复制、数据转换、格式化等
@@ -22,6 +23,7 @@ namespace Cango :: inline ByteCommunication :: inline Core {
 
 		/// @brief 将内部数据视作目标类型的引用
 		///	@tparam T 目标类型，其大小必须和 DataSize 相同
+		///	@note 不处理对齐和字节序，在不允许未对齐访问的平台上应使用 @c GetField 或 @c DecodeData
 		template <typename T>
 		requires std::is_trivially_assignable_v<T, const T>
 		[[nodiscard]] T& GetDataAs() noexcept {
@@ -38,12 +40,45 @@ namespace Cango :: inline ByteCommunication :: inline Core {
 			return *reinterpret_cast<const T*>(reinterpret_cast<const TMessage*>(this)->Data.data());
 		}
 
+		/// @brief 按字段描述从数据区读取字段，见 @c DataField
+		template <IsDataField TField>
+		[[nodiscard]] typename TField::ValueType GetField() const noexcept {
+			static_assert(TField::Offset + TField::Size <= TMessage::DataSize, "field out of data range");
+			return TField::Load(reinterpret_cast<const TMessage*>(this)->Data);
+		}
+
+		/// @brief 按字段描述将字段写入数据区，见 @c DataField
+		template <IsDataField TField>
+		void SetField(const typename TField::ValueType value) noexcept {
+			static_assert(TField::Offset + TField::Size <= TMessage::DataSize, "field out of data range");
+			TField::Store(reinterpret_cast<TMessage*>(this)->Data, value);
+		}
+
+		/// @brief 按字段表将数据区解码为本机结构，见 @c DataSchema
+		template <IsDataSchema TSchema>
+		[[nodiscard]] typename TSchema::ObjectType DecodeData() const noexcept {
+			static_assert(TSchema::RequiredSize <= TMessage::DataSize, "schema out of data range");
+			return TSchema::Decode(reinterpret_cast<const TMessage*>(this)->Data);
+		}
+
+		/// @brief 按字段表将本机结构编码到数据区，见 @c DataSchema
+		template <IsDataSchema TSchema>
+		void EncodeData(const typename TSchema::ObjectType& object) noexcept {
+			static_assert(TSchema::RequiredSize <= TMessage::DataSize, "schema out of data range");
+			TSchema::Encode(object, reinterpret_cast<TMessage*>(this)->Data);
+		}
+
 		/// @brief 构造 std::span，用于将数据从其他位置读取到此空间
 		[[nodiscard]] ByteSpan ToSpan() noexcept { return {reinterpret_cast<ByteType*>(this), TMessage::FullSize}; }
 
 		/// @brief 构造 std::span，用于将数据从此空间写入其他位置
 		[[nodiscard]] CByteSpan ToSpan() const noexcept { return {reinterpret_cast<const ByteType*>(this), TMessage::FullSize}; }
 
+		/// @brief 写入端使用，由检验器(如 @c CrcVerifier 、 @c SumChecksumVerifier )计算校验值并写入此消息
+		template <typename TSealer>
+		requires requires(TSealer& sealer, ByteSpan span) { sealer.Seal(span); }
+		void SealWith(TSealer& sealer) noexcept { sealer.Seal(ToSpan()); }
+
 		/// @brief 预定义的格式化器，将 @c TypedMessage 转化为字节区间格式化
 		struct formatter : std::formatter<CByteSpan> {
 			auto format(const TMessage& message, std::format_context& ctx) const {
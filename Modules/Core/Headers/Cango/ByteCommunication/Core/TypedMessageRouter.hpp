@@ -0,0 +1,105 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <tuple>
+#include <utility>
+
+#include <Cango/CommonUtils/ObjectOwnership.hpp>
+
+#include "ByteTypes.hpp"
+
+namespace Cango :: inline ByteCommunication :: inline Core {
+	/// @brief 带有类型字节的消息，如 @c TypedMessage
+	template <typename TMessage>
+	concept IsTypedMessage = requires(const TMessage& message) {
+		{ message.Type } -> std::convertible_to<ByteType>;
+	};
+
+	/// @brief 根据消息的类型字节将消息分发给不同处理函数的消息目标
+	///	@details
+	///		处理函数存放在以类型字节为下标的 256 项表中，分发只需要一次查表。
+	///		未登记的类型只增加丢弃计数，见 @c GetDroppedCount 。
+	///		登记处理函数不是线程安全的，应在任务开始传递消息前完成。
+	template <IsTypedMessage TMessage>
+	class TypedMessageRouter final {
+		using HandlerType = std::function<void(const TMessage&)>;
+
+		std::array<HandlerType, 256> Handlers{};
+		std::atomic<std::uint64_t> DroppedCount{0};
+
+	public:
+		using ItemType = TMessage;
+
+		/// @brief 登记处理函数，覆盖此类型已有的处理函数
+		void Register(const ByteType type, HandlerType handler) noexcept { Handlers[type] = std::move(handler); }
+
+		/// @brief 登记消息目标，此类型的消息将交给目标的 @c SetItem ，目标失效时视为丢弃
+		template <typename TDestination>
+		requires requires(TDestination& destination, const TMessage& message) { destination.SetItem(message); }
+		void Register(const ByteType type, Credential<TDestination> destination) noexcept {
+			Handlers[type] = [this, destination = std::move(destination)](const TMessage& message) {
+				if (const auto user = destination.lock()) user->SetItem(message);
+				else DroppedCount.fetch_add(1, std::memory_order_relaxed);
+			};
+		}
+
+		/// @brief 取消登记，此类型的消息将被丢弃
+		void Unregister(const ByteType type) noexcept { Handlers[type] = nullptr; }
+
+		/// @brief 获取因类型未登记或目标失效而丢弃的消息数量
+		[[nodiscard]] std::uint64_t GetDroppedCount() const noexcept { return DroppedCount.load(std::memory_order_relaxed); }
+
+		void SetItem(const TMessage& message) noexcept {
+			if (const auto& handler = Handlers[static_cast<ByteType>(message.Type)]) handler(message);
+			else DroppedCount.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		/// @brief 批量分发消息，满足 @c IsBatchItemDestination
+		void SetItems(const std::span<const TMessage> messages) noexcept {
+			for (const auto& message : messages) SetItem(message);
+		}
+	};
+
+	/// @brief 编译时登记的处理函数，见 @c StaticTypedMessageRouter
+	///	@tparam THandler 可默认构造的函数对象类型，如无捕获的 lambda 的类型
+	template <ByteType TType, std::default_initializable THandler>
+	struct TypeHandler {
+		static constexpr ByteType Type = TType;
+		using HandlerType = THandler;
+	};
+
+	/// @brief 编译时确定处理函数的 @c TypedMessageRouter
+	///	@details 所有处理函数在编译时展开为对类型字节的比较链，编译器可以将其优化为跳转表并内联处理函数
+	///	@tparam THandlers 一系列 @c TypeHandler
+	template <IsTypedMessage TMessage, typename... THandlers>
+	class StaticTypedMessageRouter final {
+		std::atomic<std::uint64_t> DroppedCount{0};
+
+	public:
+		using ItemType = TMessage;
+
+		/// @brief 处理函数对象，可以在任务开始前修改其中的状态
+		std::tuple<typename THandlers::HandlerType...> Handlers{};
+
+		/// @brief 获取因类型未登记而丢弃的消息数量
+		[[nodiscard]] std::uint64_t GetDroppedCount() const noexcept { return DroppedCount.load(std::memory_order_relaxed); }
+
+		void SetItem(const TMessage& message) noexcept {
+			const auto type = static_cast<ByteType>(message.Type);
+			const auto handled = [&]<SizeType... I>(std::index_sequence<I...>) {
+				return ((type == THandlers::Type && (std::get<I>(Handlers)(message), true)) || ...);
+			}(std::index_sequence_for<THandlers...>{});
+			if (!handled) DroppedCount.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		/// @brief 批量分发消息，满足 @c IsBatchItemDestination
+		void SetItems(const std::span<const TMessage> messages) noexcept {
+			for (const auto& message : messages) SetItem(message);
+		}
+	};
+}
@@ -0,0 +1,254 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+
+#include "RingFramer.hpp"
+
+namespace Cango :: inline ByteCommunication :: inline Core {
+	/// @brief 长度规则的概念，用于根据数据包头部确定整个数据包的长度
+	///	@details
+	///		HeaderSize 为确定长度所需的头部字节数(包含头字节)，MaxFrameSize 为数据包的最大长度，
+	///		FrameSize 根据头部返回数据包长度，如果头部无效则返回 0
+	template <typename TObject>
+	concept IsFrameLengthRule = std::default_initializable<TObject> && requires(const TObject& rule, CByteSpan header) {
+		{ TObject::HeaderSize } -> std::convertible_to<SizeType>;
+		{ TObject::MaxFrameSize } -> std::convertible_to<SizeType>;
+		{ rule.FrameSize(header) } -> std::same_as<SizeType>;
+	};
+
+	/// @brief 带长度字节的数据包格式，包含头(Head)、类型(Type)、长度(Length)、数据区(Data)、尾(Tail)
+	///	@details 长度字节为数据区长度，整个数据包的长度为 Length + 4
+	///	@tparam TMaxDataSize 允许的最大数据区长度，长度字节超过此值的数据包头视为无效
+	template <SizeType TMaxDataSize = 255>
+	requires (TMaxDataSize <= 255)
+	struct LengthPrefixRule {
+		static constexpr SizeType HeaderSize = 3;
+		static constexpr SizeType MaxFrameSize = TMaxDataSize + 4;
+
+		// ReSharper disable once CppMemberFunctionMayBeStatic
+		[[nodiscard]] constexpr SizeType FrameSize(const CByteSpan header) const noexcept {
+			const SizeType data_size = header[2];
+			return data_size > TMaxDataSize ? 0 : data_size + 4;
+		}
+	};
+
+	/// @brief 类型字节与数据区长度的对应关系，见 @c TypeLengthTable
+	template <ByteType TType, SizeType TDataSize>
+	struct TypeLength {
+		static constexpr ByteType Type = TType;
+		static constexpr SizeType DataSize = TDataSize;
+	};
+
+	/// @brief 为 @c TypedMessage 登记类型字节
+	template <ByteType TType, typename TMessage>
+	using TypedMessageLength = TypeLength<TType, TMessage::DataSize>;
+
+	/// @brief 编译时确定的类型长度表，数据包按 @c TypedMessage 的格式排列，由类型字节决定数据区长度
+	///	@details 整个数据包的长度为 DataSize + 3，未登记的类型视为无效的数据包头
+	///	@tparam TEntries 一系列 @c TypeLength ，类型字节不能重复
+	template <typename... TEntries>
+	requires (sizeof...(TEntries) > 0)
+	class TypeLengthTable {
+		[[nodiscard]] static consteval bool HasUniqueTypes() noexcept {
+			std::array<bool, 256> registered{};
+			for (const auto type : {TEntries::Type...}) {
+				if (registered[type]) return false;
+				registered[type] = true;
+			}
+			return true;
+		}
+
+		static_assert(HasUniqueTypes(), "duplicated type in TypeLengthTable");
+
+		static constexpr std::array<SizeType, 256> FrameSizes = [] {
+			std::array<SizeType, 256> sizes{};
+			((sizes[TEntries::Type] = TEntries::DataSize + 3), ...);
+			return sizes;
+		}();
+
+	public:
+		static constexpr SizeType HeaderSize = 2;
+		static constexpr SizeType MaxFrameSize = std::max({TEntries::DataSize...}) + 3;
+
+		// ReSharper disable once CppMemberFunctionMayBeStatic
+		[[nodiscard]] constexpr SizeType FrameSize(const CByteSpan header) const noexcept {
+			return FrameSizes[header[1]];
+		}
+	};
+
+	/// @brief 检验数据包长度是否与长度规则一致
+	template <IsFrameLengthRule TLengthRule>
+	class FrameLengthVerifier final {
+	public:
+		TLengthRule LengthRule{};
+
+		[[nodiscard]] bool Verify(const CByteSpan span) const noexcept {
+			if (span.size() < TLengthRule::HeaderSize) return false;
+			return LengthRule.FrameSize(span) == span.size();
+		}
+	};
+
+	/// @brief 长度可变的数据包，作为变长数据包的消息类型
+	template <SizeType TMaxFrameSize>
+	struct VariableFrame {
+		static constexpr SizeType MaxSize = TMaxFrameSize;
+
+		ByteArray<TMaxFrameSize> Bytes{};
+		SizeType Size{0};
+
+		/// @brief 复制数据包
+		///	@return 数据包是否完整复制，如果数据包过长则不做任何修改并返回 false
+		bool Assign(const CByteSpan frame) noexcept {
+			if (frame.size() > TMaxFrameSize) return false;
+			std::ranges::copy(frame, Bytes.begin());
+			Size = frame.size();
+			return true;
+		}
+
+		[[nodiscard]] ByteSpan ToSpan() noexcept { return {Bytes.data(), Size}; }
+
+		[[nodiscard]] CByteSpan ToSpan() const noexcept { return {Bytes.data(), Size}; }
+	};
+
+	/// @brief 按 @c LengthPrefixRule 的格式构造数据包
+	///	@return 数据包是否能放入 frame
+	template <SizeType TMaxFrameSize>
+	bool MakeLengthPrefixedFrame(
+		VariableFrame<TMaxFrameSize>& frame,
+		const ByteType type,
+		const CByteSpan data,
+		const ByteType head = '!',
+		const ByteType tail = 0) noexcept {
+		if (data.size() > 255 || data.size() + 4 > TMaxFrameSize) return false;
+		frame.Bytes[0] = head;
+		frame.Bytes[1] = type;
+		frame.Bytes[2] = static_cast<ByteType>(data.size());
+		std::ranges::copy(data, frame.Bytes.begin() + 3);
+		frame.Bytes[data.size() + 3] = tail;
+		frame.Size = data.size() + 4;
+		return true;
+	}
+
+	/// @brief 基于环形缓冲区的变长数据包分帧器，数据包长度由长度规则根据头部确定
+	///	@details
+	///		与 @c RingFramer 相同，可以写入任意数量的字节，并依次取出所有完整且通过检验的数据包。
+	///		当头部指示的数据包尚未完整到达时，分帧器保留这部分字节等待后续数据。
+	///	@tparam TLengthRule 长度规则，见 @c IsFrameLengthRule
+	///	@tparam TVerifier 用于检验完整的数据包是否符合要求
+	///	@tparam TCapacity 缓冲区容量，必须是 2 的幂，且不小于最大数据包长度
+	template <IsFrameLengthRule TLengthRule, IsVerifier TVerifier, SizeType TCapacity = SizeType{1} << 17>
+	requires (TLengthRule::HeaderSize > 0
+		&& TLengthRule::HeaderSize <= TLengthRule::MaxFrameSize
+		&& std::has_single_bit(TCapacity)
+		&& TLengthRule::MaxFrameSize <= TCapacity)
+	class VariableRingFramer final {
+		RingByteBuffer<TCapacity, TLengthRule::MaxFrameSize - 1> Buffer{};
+
+		/// @brief 上一个数据包之后丢弃过字节，输出下一个数据包时记为一次重新同步
+		bool IsResyncPending{false};
+
+	public:
+		using LengthRuleType = TLengthRule;
+		using VerifierType = TVerifier;
+		using FrameType = VariableFrame<TLengthRule::MaxFrameSize>;
+		static constexpr SizeType Capacity = TCapacity;
+
+		ByteType HeadByte{'!'};
+		TLengthRule LengthRule{};
+		TVerifier Verifier{};
+
+		/// @brief 记录输出的数据包、重新同步和检验失败的次数，为空时不记录
+		ObjectUser<ConnectionCounters> Counters{};
+
+		/// @brief 缓冲区中尚未取出的字节数
+		[[nodiscard]] SizeType Size() const noexcept { return Buffer.Size(); }
+
+		/// @brief 缓冲区剩余可写入的字节数
+		[[nodiscard]] SizeType FreeSize() const noexcept { return Buffer.FreeSize(); }
+
+		/// @copydoc RingByteBuffer::WritableSpan
+		[[nodiscard]] ByteSpan WritableSpan() noexcept { return Buffer.WritableSpan(); }
+
+		/// @copydoc RingByteBuffer::Commit
+		void Commit(const SizeType count) noexcept { Buffer.Commit(count); }
+
+		/// @copydoc RingByteBuffer::Write
+		SizeType Write(const CByteSpan bytes) noexcept { return Buffer.Write(bytes); }
+
+		/// @brief 至少还需要写入多少字节，缓冲区中的下一个数据包才可能完整
+		///	@details
+		///		字节不足一个头部时补足头部；以有效头部开头时补足头部指示的数据包；否则为 1。
+		///		在 @c Next 返回 false 后按此长度阻塞读取，不会读到下一个数据包的字节
+		[[nodiscard]] SizeType MissingSize() const noexcept {
+			constexpr auto header_size = TLengthRule::HeaderSize;
+			const auto size = Buffer.Size();
+			if (size < header_size) return header_size - size;
+			if (Buffer.Peek(0, 1).front() != HeadByte) return 1;
+			const auto frame_size = LengthRule.FrameSize(Buffer.Peek(0, header_size));
+			if (frame_size <= size || frame_size > TLengthRule::MaxFrameSize) return 1;
+			return frame_size - size;
+		}
+
+		/// @brief 取出下一个完整的数据包，头字节之前、头部无效和未通过检验的字节将被丢弃
+		///	@param frame 指向缓冲区内部的数据包，在下一次写入前有效
+		///	@return 是否找到数据包
+		[[nodiscard]] bool Next(CByteSpan& frame) noexcept {
+			constexpr auto header_size = TLengthRule::HeaderSize;
+			while (Buffer.Size() >= header_size) {
+				const auto available = Buffer.Size();
+				const auto candidates = std::min(available - header_size + 1, Buffer.ContiguousSize());
+				SizeType frame_size{0};
+				bool is_incomplete{false};
+				const auto offset = FindEachByte(
+					Buffer.Peek(0, candidates),
+					HeadByte,
+					[this, available, &frame_size, &is_incomplete](const SizeType index) {
+						frame_size = LengthRule.FrameSize(Buffer.Peek(index, header_size));
+						if (frame_size < header_size || frame_size > TLengthRule::MaxFrameSize) return false;
+						if (index + frame_size > available) return is_incomplete = true;
+						if (Verifier.Verify(Buffer.Peek(index, frame_size))) return true;
+						if (Counters) Counters->VerifyRejects.Add();
+						return false;
+					}
+				);
+				if (offset == candidates) {
+					Buffer.Discard(candidates);
+					IsResyncPending = true;
+					continue;
+				}
+
+				if (offset != 0) IsResyncPending = true;
+				if (is_incomplete) {
+					Buffer.Discard(offset);
+					return false;
+				}
+
+				frame = Buffer.Peek(offset, frame_size);
+				Buffer.Discard(offset + frame_size);
+				if (Counters) {
+					Counters->FramesEmitted.Add();
+					if (IsResyncPending) Counters->Resyncs.Add();
+				}
+				IsResyncPending = false;
+				return true;
+			}
+			return false;
+		}
+
+		/// @brief 取出下一个完整的数据包，并复制到目标位置
+		[[nodiscard]] bool Examine(FrameType& destination) noexcept {
+			CByteSpan frame;
+			return Next(frame) && destination.Assign(frame);
+		}
+
+		/// @brief 取出缓冲区中所有完整的数据包，直到目标区间已满
+		///	@return 输出的数据包数量
+		[[nodiscard]] SizeType ExamineAll(const std::span<FrameType> destination) noexcept {
+			SizeType count{0};
+			while (count < destination.size() && Examine(destination[count])) ++count;
+			return count;
+		}
+	};
+}
@@ -11,6 +11,24 @@ namespace Cango :: inline ByteCommunication :: inline Core {
 		{ object.Verify(span) } -> std::convertible_to<bool>;
 	};
 
+	/// @brief 可以与其他 @c Verifier 融合遍历的 @c Verifier ，见 @c AllOfVerifier
+	///	@details
+	///		检验过程拆分为对字节区间的折叠(如求和、异或、CRC)和最后的比较：
+	///		FoldRange 根据数据包长度给出需要折叠的范围 [begin, end)，长度不足时返回 false；
+	///		FoldBegin 给出初始状态，Fold 按顺序处理范围内的一段字节，FoldEnd 根据最终状态和完整的数据包给出检验结果。
+	template <typename TObject>
+	concept IsFoldingVerifier = IsVerifier<TObject> && requires(
+		TObject& object,
+		CByteSpan span,
+		SizeType size,
+		SizeType& position,
+		typename TObject::FoldStateType& state) {
+		{ object.FoldRange(size, position, position) } -> std::same_as<bool>;
+		{ object.FoldBegin() } -> std::same_as<typename TObject::FoldStateType>;
+		object.Fold(state, span);
+		{ object.FoldEnd(state, span) } -> std::same_as<bool>;
+	};
+
 	/// @brief 返回常量的 @c Verifier
 	template<bool TResult>
 	class ConstexprResultVerifier final {
@@ -22,6 +40,27 @@ namespace Cango :: inline ByteCommunication :: inline Core {
 	using AllowAnythingVerifier = ConstexprResultVerifier<true>;
 	using DenyAnythingVerifier = ConstexprResultVerifier<false>;
 
+	/// @brief 检验数据包头部是否为目标字节
+	template<ByteType THeadByte>
+	class HeadByteVerifier final {
+	public:
+		// ReSharper disable once CppMemberFunctionMayBeStatic
+		[[nodiscard]] bool Verify(const CByteSpan span) const noexcept { // NOLINT(*-convert-member-functions-to-static)
+			if (span.empty()) return false;
+			return span.front() == THeadByte;
+		}
+	};
+
+	/// @brief 检验数据包长度是否为目标长度
+	template<SizeType TSize>
+	class SizeVerifier final {
+	public:
+		// ReSharper disable once CppMemberFunctionMayBeStatic
+		[[nodiscard]] bool Verify(const CByteSpan span) const noexcept { // NOLINT(*-convert-member-functions-to-static)
+			return span.size() == TSize;
+		}
+	};
+
 	/// @brief 检验数据包尾部是否为目标字节
 	template<ByteType TTailByte>
 	class TailByteVerifier final {
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <Cango/ByteCommunication/Core.hpp>
+
+/// @brief 测试程序共用的数据生成、回环任务和检查工具，只由 Testers 中的程序包含
+namespace Cango :: inline ByteCommunication :: Testers {
+	/// @brief 在 bytes 末尾追加 count 个 message 的完整字节
+	template <typename TMessage>
+	void AppendFrames(std::vector<ByteType>& bytes, const TMessage& message, const std::size_t count = 1) {
+		const auto span = message.ToSpan();
+		for (std::size_t index = 0; index < count; ++index) bytes.insert(bytes.end(), span.begin(), span.end());
+	}
+
+	/// @brief 生成 count 个连续的消息，第 i 个消息的 Type 为 i 的低 8 位，用于检查顺序
+	template <typename TMessage>
+	[[nodiscard]] std::vector<ByteType> MakeFrames(const std::size_t count) {
+		std::vector<ByteType> bytes{};
+		bytes.reserve(count * TMessage::FullSize);
+		TMessage message{};
+		for (std::size_t index = 0; index < count; ++index) {
+			message.Type = static_cast<ByteType>(index);
+			AppendFrames(bytes, message);
+		}
+		return bytes;
+	}
+
+	/// @brief 读满 buffer，最多等待 timeout，用于消息丢失时测试程序仍能结束
+	///	@return 是否在超时前读满
+	template <IsPartialReader TReader>
+	[[nodiscard]] bool ReadWithin(TReader& reader, const ByteSpan buffer, const TimeoutType timeout) noexcept {
+		const auto deadline = std::chrono::steady_clock::now() + timeout;
+		for (SizeType read = 0; read < buffer.size();) {
+			const auto now = std::chrono::steady_clock::now();
+			if (now >= deadline) return false;
+			read += reader.ReadSome(buffer.subspan(read), deadline - now);
+		}
+		return true;
+	}
+
+	/// @brief 汇总测试程序中的检查，任一检查失败时 main 返回非零值
+	class Checker final {
+		int Result{0};
+
+	public:
+		/// @brief condition 不成立时输出 what 并记录失败
+		void operator()(const bool condition, const std::string_view what) {
+			if (condition) return;
+			std::cout << std::format("FAILED: {}\n", what);
+			Result = 1;
+		}
+
+		[[nodiscard]] int GetResult() const noexcept { return Result; }
+	};
+
+	/// @brief 记录内部读取器是否已经读完的 @c IsReader 装饰器，用于结束测试程序的读取循环
+	///	@details 适配器总是阻塞读取，不限时的 ReadSome 返回 0 或 ReadBytes 读取不足时，写入端已关闭且字节已读完
+	template <IsReader TReader>
+	class EndOfStreamReader final {
+		ObjectUser<TReader> Reader{};
+		bool IsEndReached{false};
+
+		struct Configurations {
+			struct ActorsType {
+				ObjectUser<TReader>& Reader;
+			} Actors;
+		};
+
+	public:
+		[[nodiscard]] Configurations Configure() noexcept { return {.Actors = {Reader}}; }
+
+		[[nodiscard]] bool IsFunctional() const noexcept { return ValidateAll(Reader); }
+
+		[[nodiscard]] SizeType ReadBytes(const ByteSpan buffer) noexcept {
+			const auto bytes = Reader->ReadBytes(buffer);
+			if (bytes < buffer.size()) IsEndReached = true;
+			return bytes;
+		}
+
+		[[nodiscard]] SizeType ReadSome(const ByteSpan buffer, const TimeoutType timeout) noexcept
+		requires IsPartialReader<TReader> {
+			const auto bytes = Reader->ReadSome(buffer, timeout);
+			if (bytes == 0 && !buffer.empty() && timeout == NoTimeout) IsEndReached = true;
+			return bytes;
+		}
+
+		[[nodiscard]] bool IsEnded() const noexcept { return IsEndReached; }
+	};
+
+	/// @brief 从适配器取出消息，直到读取器读完且缓冲区中没有完整的消息
+	///	@details 读完后读取立即返回，适配器的 GetItem 返回 false 说明剩余的字节不足一个消息
+	///	@return 取出的消息数量
+	template <typename TAdapter, typename TReader>
+	[[nodiscard]] std::size_t DrainMessages(TAdapter& adapter, const EndOfStreamReader<TReader>& reader) {
+		typename TAdapter::ItemType message{};
+		std::size_t count = 0;
+		while (true) {
+			if (adapter.GetItem(message)) ++count;
+			else if (reader.IsEnded()) return count;
+		}
+	}
+
+	/// @brief 通过回环连接运行 @c EasyCommunicationTask 的测试环境
+	///	@details
+	///		构造时配置连接提供者、消息池和监视器，测试程序在 Start 前修改任务和消息池的配置。
+	///		Start 在单独的线程中执行任务并等到第一个连接；Stop 或析构时中断所有子任务，关闭远端并等待任务结束。
+	///	@tparam TPeerDestination 接收远端读写器的物品目标，默认保存最新的一个，由 WaitPeer 取出
+	template <
+		std::default_initializable TMessage,
+		IsItemSource TWriterMessagePool = AsyncItemPool<TMessage>,
+		IsItemDestination TReaderMessagePool = AsyncItemPool<TMessage>,
+		SizeType TWriterBatchSize = 1,
+		IsItemDestination TPeerDestination = AsyncItemPool<Owner<LoopbackRWer<>>>>
+	class LoopbackTask final {
+	public:
+		using ProviderType = LoopbackRWerProvider<LoopbackRWer<>::RingType::Capacity, TPeerDestination>;
+		using TaskType = EasyCommunicationTask<
+			ProviderType, TMessage, TMessage, TWriterMessagePool, TReaderMessagePool, TWriterBatchSize>;
+
+		Owner<ProviderType> Provider{};
+		Owner<TPeerDestination> Peers{};
+		EasyCommunicationTaskPoolsAndMonitors<TMessage, TMessage, TWriterMessagePool, TReaderMessagePool> Utils{};
+		TaskType Task{};
+
+		/// @brief 最近一次 WaitPeer 取出的远端读写器
+		typename ProviderType::ItemType Peer{};
+
+		LoopbackTask() noexcept {
+			Provider->Configure().Actors.PeerDestination = Peers;
+			Utils.Apply(Task);
+			Task.Configure().Actors.Provider = Provider;
+		}
+
+		LoopbackTask(const LoopbackTask&) = delete;
+		LoopbackTask& operator=(const LoopbackTask&) = delete;
+
+		~LoopbackTask() noexcept { Stop(); }
+
+		/// @brief 在单独的线程中执行任务，远端读写器由 Peers 取出时等到第一个连接
+		void Start() {
+			Thread = std::thread{[this] { Task.Execute(); }};
+			if constexpr (requires { Peers->GetItem(Peer); }) WaitPeer();
+		}
+
+		/// @brief 等到下一个连接，远端读写器保存在 Peer 中
+		void WaitPeer() noexcept { while (!Peers->GetItem(Peer)) std::this_thread::yield(); }
+
+		/// @brief 中断所有子任务，不等待任务结束
+		void Interrupt() noexcept {
+			Utils.ProviderMonitor->Interrupt();
+			Utils.ReaderMonitor->Interrupt();
+			Utils.WriterMonitor->Interrupt();
+		}
+
+		/// @brief 中断所有子任务，关闭远端使阻塞的读取返回，然后等待任务结束
+		void Stop() noexcept {
+			if (!Thread.joinable()) return;
+			Interrupt();
+			if (Peer && Peer->IsFunctional()) Peer->Close();
+			Thread.join();
+		}
+
+	private:
+		std::thread Thread{};
+	};
+}
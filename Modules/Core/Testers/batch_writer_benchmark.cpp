@@ -0,0 +1,62 @@
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <Cango/ByteCommunication/Core.hpp>
+#include "TesterUtils.hpp"
+
+using namespace Cango;
+using namespace Cango::Testers;
+using Message = TypedMessage<6>;
+
+namespace {
+	/// @brief 测量写入任务把消息队列中的消息发送到远端的吞吐量
+	template <SizeType TWriterBatchSize>
+	void Measure(Checker& check, const std::string_view name, const std::chrono::milliseconds writerMinInterval) {
+		constexpr std::size_t count = 2048;
+		using PoolType = MpscMessageQueue<Message, 4096>;
+		LoopbackTask<Message, PoolType, AsyncItemPool<Message>, TWriterBatchSize> loopback{};
+		const auto& pool = loopback.Utils.WriterMessagePool;
+		{
+			const auto options = pool->Configure().Options;
+			options.Policy = OverflowPolicy::Block;
+			options.BlockTimeout = std::chrono::seconds{10};
+		}
+		{
+			const auto config = loopback.Task.Configure();
+			config.Options.ReaderMinInterval = std::chrono::milliseconds{1};
+			config.Options.WriterMinInterval = writerMinInterval;
+		}
+		loopback.Start();
+
+		Message message{};
+		std::vector<ByteType> received(count * Message::FullSize);
+		const auto begin = std::chrono::steady_clock::now();
+		for (std::size_t index = 0; index < count; ++index) {
+			message.Type = static_cast<ByteType>(index);
+			pool->SetItem(message);
+		}
+		const auto is_complete = ReadWithin(*loopback.Peer, received, std::chrono::seconds{10});
+		const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+		loopback.Stop();
+
+		std::size_t ordered = 0;
+		for (std::size_t index = 0; index < count; ++index)
+			if (received[index * Message::FullSize + 1] == static_cast<ByteType>(index)) ++ordered;
+		std::cout << std::format(
+			"{:<28} {:>10.0f} msg/s, {} / {} in order\n",
+			name, static_cast<double>(count) / seconds, ordered, count);
+		check(is_complete && ordered == count, "the writer sends every message in order");
+	}
+}
+
+int main() {
+	Checker check{};
+	Measure<1>(check, "per message, 1 ms interval", std::chrono::milliseconds{1});
+	Measure<64>(check, "batch 64, 1 ms interval", std::chrono::milliseconds{1});
+	Measure<1>(check, "per message, 0 ms interval", std::chrono::milliseconds{0});
+	Measure<64>(check, "batch 64, 0 ms interval", std::chrono::milliseconds{0});
+	return check.GetResult();
+}
@@ -0,0 +1,93 @@
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <Cango/ByteCommunication/Core.hpp>
+#include "TesterUtils.hpp"
+
+using namespace Cango;
+using namespace Cango::Testers;
+using Message = TypedMessage<6>;
+
+namespace {
+	constexpr std::size_t MessageCount = 100000;
+
+	/// @brief 通过回环连接逐个写入消息，远端读取全部字节
+	///	@return 远端收到的字节数
+	template <typename TWriter>
+	std::size_t Transfer(TWriter& writer, LoopbackRWer<>& peer, double& seconds) {
+		std::size_t received = 0;
+		std::thread reader{
+			[&peer, &received] {
+				std::vector<ByteType> chunk(4096);
+				while (received < MessageCount * Message::FullSize) {
+					const auto bytes = peer.ReadSome(chunk, NoTimeout);
+					if (bytes == 0) break;
+					received += bytes;
+				}
+			}
+		};
+
+		Message message{};
+		const auto begin = std::chrono::steady_clock::now();
+		for (std::size_t index = 0; index < MessageCount; ++index) {
+			message.Type = static_cast<ByteType>(index);
+			(void)writer.WriteBytes(message.ToSpan());
+		}
+		if constexpr (requires { writer.Flush(); }) (void)writer.Flush();
+		reader.join();
+		seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+		return received;
+	}
+}
+
+/// @brief 比较直接写入和经过 @c BufferedWriter 写入时内部写入器的调用次数，并检查写出失败的统计
+int main() {
+	Checker check{};
+
+	{
+		LoopbackRWerPair pair{};
+		double seconds{};
+		const auto received = Transfer(*pair.First, *pair.Second, seconds);
+		std::cout << std::format(
+			"direct    writes {:>7}, syscalls {:>7}, {:>8.2f} M msg/s\n",
+			MessageCount, MessageCount, static_cast<double>(MessageCount) / seconds / 1e6);
+		check(received == MessageCount * Message::FullSize, "direct transfer delivers every byte");
+	}
+
+	{
+		LoopbackRWerPair pair{};
+		BufferedWriter<LoopbackRWer<>> writer{};
+		writer.Configure().Actors.Writer = pair.First;
+		double seconds{};
+		const auto received = Transfer(writer, *pair.Second, seconds);
+		const auto statistics = writer.GetStatistics();
+		std::cout << std::format(
+			"buffered  writes {:>7}, syscalls {:>7}, {:>8.2f} M msg/s\n",
+			statistics.WriteCount, statistics.FlushCount, static_cast<double>(MessageCount) / seconds / 1e6);
+		check(received == MessageCount * Message::FullSize, "buffered transfer delivers every byte");
+		check(statistics.WriteCount == MessageCount, "every WriteBytes is counted");
+		check(statistics.FlushCount * 100 < statistics.WriteCount, "buffering coalesces at least 100 writes per syscall");
+		check(statistics.FailedFlushCount == 0 && statistics.DroppedByteCount == 0, "no flush fails on an open link");
+	}
+
+	{
+		// 远端关闭后按时写出失败，失败由统计和下一次 Flush 报告，之后的写入仍被接受
+		LoopbackRWerPair pair{};
+		BufferedWriter<LoopbackRWer<>> writer{};
+		writer.Configure().Actors.Writer = pair.First;
+		pair.Second->Close();
+		const Message message{};
+		check(writer.WriteBytes(message.ToSpan()) == Message::FullSize, "write before the deadline flush is accepted");
+		std::this_thread::sleep_for(std::chrono::milliseconds{20});
+		check(writer.WriteBytes(message.ToSpan()) == Message::FullSize, "write after a failed deadline flush is accepted");
+		check(!writer.Flush(), "Flush reports the failed deadline flush");
+		const auto statistics = writer.GetStatistics();
+		std::cout << std::format(
+			"closed    failed flushes {}, dropped bytes {}\n", statistics.FailedFlushCount, statistics.DroppedByteCount);
+		check(statistics.DroppedByteCount == 2 * Message::FullSize, "both buffered messages are counted as dropped");
+		check(writer.Flush(), "a failure is reported once");
+	}
+	return check.GetResult();
+}
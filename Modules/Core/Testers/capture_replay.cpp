@@ -0,0 +1,78 @@
+#include <chrono>
+#include <filesystem>
+#include <format>
+#include <iostream>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <Cango/ByteCommunication/Core.hpp>
+#include "TesterUtils.hpp"
+
+using namespace Cango;
+using namespace Cango::Testers;
+using Message = TypedMessage<6>;
+
+namespace {
+	/// @brief 通过回环读写器产生一段记录，每 1024 个消息为一次写入
+	void RecordSample(const std::filesystem::path& path, const std::size_t count) {
+		const Owner<CaptureWriter> capture{path, count * (Message::FullSize + CaptureFormat::RecordHeaderSize)};
+		LoopbackRWerPair pair{};
+		const Owner<RecordingRWer<LoopbackRWer<>>> recorder{};
+		const auto config = recorder->Configure();
+		config.Actors.RWer = pair.Second;
+		config.Actors.Capture = capture;
+
+		std::thread writer{
+			[&pair, count] {
+				const auto frames = MakeFrames<Message>(1024);
+				for (std::size_t sent = 0; sent < count; sent += 1024) (void)pair.First->WriteBytes(frames);
+				pair.First->Close();
+			}
+		};
+		std::vector<ByteType> buffer(4096);
+		while (recorder->ReadSome(buffer, NoTimeout) != 0) {}
+		writer.join();
+	}
+}
+
+/// @brief 用法: capture_replay [记录文件] [--realtime]
+///	@details 未指定记录文件时先生成一段示例记录并检查回放出的消息数量，然后通过 @c ReaderToMessageSourceAdapter 回放并统计吞吐量
+int main(const int argc, const char* argv[]) {
+	constexpr std::size_t sample_count = 1 << 22;
+	std::filesystem::path path{};
+	bool is_real_time = false;
+	for (int index = 1; index < argc; ++index) {
+		if (std::string_view{argv[index]} == "--realtime") is_real_time = true;
+		else path = argv[index];
+	}
+	const auto is_sample = path.empty();
+	if (is_sample) {
+		path = std::filesystem::temp_directory_path() / "cango_capture_sample.bin";
+		RecordSample(path, sample_count);
+	}
+
+	const Owner<ReplayReader> replay{path};
+	if (!replay->IsFunctional()) {
+		std::cout << std::format("invalid capture file: {}\n", path.string());
+		return 1;
+	}
+	replay->Configure().Options.IsRealTime = is_real_time;
+
+	const Owner<EndOfStreamReader<ReplayReader>> reader{};
+	reader->Configure().Actors.Reader = replay;
+	ReaderToMessageSourceAdapter<EndOfStreamReader<ReplayReader>, Message, TailZeroVerifier> adapter{};
+	adapter.Configure().Actors.Reader = reader;
+	const auto begin = std::chrono::steady_clock::now();
+	const auto messages = DrainMessages(adapter, *reader);
+	const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+	std::cout << std::format(
+		"{} messages in {:.3f} s ({:.2f} M msg/s, {:.1f} MiB/s)\n",
+		messages, seconds,
+		static_cast<double>(messages) / seconds / 1e6,
+		static_cast<double>(messages * Message::FullSize) / seconds / (1 << 20));
+
+	Checker check{};
+	if (is_sample) check(messages == sample_count, "replay emits every recorded message");
+	return check.GetResult();
+}
@@ -0,0 +1,73 @@
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <Cango/ByteCommunication/Core.hpp>
+#include "TesterUtils.hpp"
+
+using namespace Cango;
+using namespace Cango::Testers;
+using Message = TypedMessage<6>;
+
+/// @brief 通过回环连接发送正常、错位和损坏的数据，然后断开重连，检查连接计数器
+int main() {
+	LoopbackTask<Message, AsyncItemPool<Message>, SpscMessageQueue<Message>> loopback{};
+	Owner<ConnectionCounters> counters{};
+	{
+		const auto config = loopback.Task.Configure();
+		config.Actors.Counters = counters;
+		config.Options.ReaderMinInterval = std::chrono::milliseconds{0};
+		config.Options.ProviderMinInterval = std::chrono::milliseconds{1};
+	}
+	loopback.Start();
+
+	// 计数器由任务线程更新，等到预期的状态或超时，超时后由下面的检查报告
+	const auto wait_until = [&counters](const auto& predicate) {
+		const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{1};
+		while (!predicate(counters->Snapshot()) && std::chrono::steady_clock::now() < deadline)
+			std::this_thread::sleep_for(std::chrono::milliseconds{1});
+	};
+
+	std::vector<ByteType> bytes{};
+	Message message{};
+	AppendFrames(bytes, message, 100);
+	bytes.insert(bytes.end(), {0x12, 0x34, 0x56}); // 错位，之后的数据包需要重新同步
+	AppendFrames(bytes, message, 100);
+	message.Tail = 1; // 尾字节不为 0，无法通过检验
+	AppendFrames(bytes, message, 10);
+	message.Tail = 0;
+	AppendFrames(bytes, message, 100);
+	(void)loopback.Peer->WriteBytes(bytes);
+	loopback.Utils.WriterMessagePool->SetItem(message);
+
+	// 读取任务每次读取一个消息的长度，错位的 3 个字节使之后的读取都错开，
+	// 最后一个数据包只剩 3 个字节，在远端关闭时读取不足，不会输出
+	constexpr std::uint64_t expected_frames = 299;
+	wait_until([](const auto& statistics) {
+		return statistics.FramesEmitted == expected_frames && statistics.BytesWritten == Message::FullSize;
+	});
+	loopback.Peer->Close();
+	loopback.Utils.ReaderMonitor->Interrupt(); // 结束当前连接，获取新的连接
+	loopback.WaitPeer();
+	wait_until([&bytes](const auto& statistics) {
+		return statistics.Reconnects == 1 && statistics.BytesRead == bytes.size();
+	});
+	loopback.Stop();
+
+	const auto statistics = counters->Snapshot();
+	std::cout << std::format(
+		"bytes read {}, bytes written {}, frames {}, resyncs {}, verify rejects {}, short reads {}, reconnects {}\n",
+		statistics.BytesRead, statistics.BytesWritten, statistics.FramesEmitted, statistics.Resyncs,
+		statistics.VerifyRejects, statistics.ShortReads, statistics.Reconnects);
+
+	Checker check{};
+	check(statistics.BytesRead == bytes.size(), "every byte sent by the peer is counted as read");
+	check(statistics.BytesWritten == Message::FullSize, "the written message is counted");
+	check(statistics.FramesEmitted == expected_frames, "every complete valid frame is emitted");
+	check(statistics.Resyncs == 1, "the misplaced bytes cause one resync");
+	check(statistics.VerifyRejects == 10, "every frame with a bad tail is rejected");
+	check(statistics.ShortReads == 1, "the read cut off by the close is a short read");
+	check(statistics.Reconnects == 1, "the second connection is counted as a reconnect");
+	return check.GetResult();
+}
@@ -0,0 +1,54 @@
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <Cango/ByteCommunication/Core.hpp>
+
+/// @brief 改进前的格式化方式，逐字节交给 std::formatter<Cango::ByteType>
+struct PerByteSpan {
+	Cango::CByteSpan Span;
+};
+
+template<>
+struct std::formatter<PerByteSpan> : std::formatter<Cango::ByteType> {
+	auto format(const PerByteSpan& value, std::format_context& ctx) const {
+		const auto span = value.Span;
+		if (span.empty()) return ctx.out();
+		for (const auto& element : span.subspan(0, span.size() - 1)) {
+			const auto it = std::formatter<Cango::ByteType>::format(element, ctx);
+			std::format_to(it, " ");
+		}
+		return std::formatter<Cango::ByteType>::format(span.back(), ctx);
+	}
+};
+
+template <typename TValue>
+double MeasureNanoseconds(const TValue& value, const std::size_t repeat, std::string& output) {
+	const auto begin = std::chrono::steady_clock::now();
+	for (std::size_t index = 0; index < repeat; ++index) {
+		output.clear();
+		std::format_to(std::back_inserter(output), "{:02X}", value);
+	}
+	const auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(end - begin).count() / static_cast<double>(repeat);
+}
+
+int main() {
+	for (const std::size_t size : {16, 256, 4096}) {
+		std::vector<Cango::ByteType> bytes(size);
+		for (std::size_t index = 0; index < size; ++index) bytes[index] = static_cast<Cango::ByteType>(index * 131 + 7);
+
+		const Cango::CByteSpan span{bytes};
+		const auto repeat = (1 << 24) / size;
+		std::string fast_output;
+		std::string slow_output;
+		const auto fast = MeasureNanoseconds(span, repeat, fast_output);
+		const auto slow = MeasureNanoseconds(PerByteSpan{span}, repeat, slow_output);
+
+		std::cout << std::format(
+			"{:>5} B: per-byte {:>10.1f} ns, lookup table {:>10.1f} ns, speedup {:>5.1f}x{}\n",
+			size, slow, fast, slow / fast, fast_output == slow_output ? "" : " (MISMATCH)");
+	}
+	return 0;
+}
@@ -0,0 +1,99 @@
+#include <atomic>
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <Cango/ByteCommunication/Core.hpp>
+#include "TesterUtils.hpp"
+
+using namespace Cango;
+using namespace Cango::Testers;
+using Message = TypedMessage<6>;
+
+namespace {
+	double SecondsSince(const std::chrono::steady_clock::time_point begin) {
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	}
+
+	/// @brief 以 4 KiB 为单位写入的原始吞吐量
+	void MeasureRawBytes(Checker& check) {
+		constexpr std::size_t total = std::size_t{1} << 30;
+		LoopbackRWerPair pair{};
+		std::thread writer{
+			[&pair] {
+				std::vector<ByteType> chunk(4096);
+				for (std::size_t sent = 0; sent < total; sent += chunk.size()) (void)pair.First->WriteBytes(chunk);
+			}
+		};
+
+		std::vector<ByteType> chunk(4096);
+		std::size_t received = 0;
+		const auto begin = std::chrono::steady_clock::now();
+		while (received < total) received += pair.Second->ReadSome(chunk, NoTimeout);
+		const auto seconds = SecondsSince(begin);
+		writer.join();
+		std::cout << std::format("raw bytes:     {:>8.2f} GiB/s\n", static_cast<double>(total) / seconds / (1 << 30));
+		check(received == total, "raw transfer delivers every byte");
+	}
+
+	/// @brief 分帧和校验的吞吐量，不经过任务和消息池
+	void MeasureFraming(Checker& check) {
+		constexpr std::size_t count = 1 << 22;
+		const auto frames = MakeFrames<Message>(1024);
+		LoopbackRWerPair pair{};
+		std::thread writer{
+			[&pair, &frames] {
+				for (std::size_t sent = 0; sent < count; sent += 1024) (void)pair.First->WriteBytes(frames);
+				pair.First->Close();
+			}
+		};
+
+		const Owner<EndOfStreamReader<LoopbackRWer<>>> reader{};
+		reader->Configure().Actors.Reader = pair.Second;
+		StreamReaderToMessageSourceAdapter<EndOfStreamReader<LoopbackRWer<>>, Message, TailZeroVerifier> adapter{};
+		adapter.Configure().Actors.Reader = reader;
+		const auto begin = std::chrono::steady_clock::now();
+		const auto received = DrainMessages(adapter, *reader);
+		const auto seconds = SecondsSince(begin);
+		writer.join();
+		std::cout << std::format("framing:       {:>8.2f} M msg/s\n", static_cast<double>(received) / seconds / 1e6);
+		check(received == count, "framing emits every message");
+	}
+
+	struct CountingDestination {
+		using ItemType = Message;
+		std::atomic<std::size_t> Count{0};
+		void SetItem(const Message&) noexcept { Count.fetch_add(1, std::memory_order_relaxed); }
+	};
+
+	/// @brief 通过 @c CommunicationTask 的端到端吞吐量
+	void MeasureCommunicationTask(Checker& check) {
+		constexpr std::size_t count = 1 << 20;
+		LoopbackTask<Message, AsyncItemPool<Message>, CountingDestination> loopback{};
+		loopback.Start();
+
+		const auto& destination = loopback.Utils.ReaderMessagePool;
+		const auto frames = MakeFrames<Message>(1024);
+		const auto begin = std::chrono::steady_clock::now();
+		for (std::size_t sent = 0; sent < count; sent += 1024) (void)loopback.Peer->WriteBytes(frames);
+		// 回环连接不丢失字节，等待时间只是防止消息丢失时无法结束
+		const auto deadline = begin + std::chrono::seconds{10};
+		while (destination->Count.load(std::memory_order_relaxed) < count && std::chrono::steady_clock::now() < deadline)
+			std::this_thread::yield();
+		const auto seconds = SecondsSince(begin);
+		loopback.Stop();
+
+		const auto received = destination->Count.load(std::memory_order_relaxed);
+		std::cout << std::format("task:          {:>8.2f} M msg/s\n", static_cast<double>(received) / seconds / 1e6);
+		check(received == count, "the task delivers every message");
+	}
+}
+
+int main() {
+	Checker check{};
+	MeasureRawBytes(check);
+	MeasureFraming(check);
+	MeasureCommunicationTask(check);
+	return check.GetResult();
+}
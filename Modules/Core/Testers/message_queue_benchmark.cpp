@@ -0,0 +1,109 @@
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <Cango/ByteCommunication/Core.hpp>
+#include "TesterUtils.hpp"
+
+using namespace Cango;
+using namespace Cango::Testers;
+using Message = TypedMessage<6>;
+
+namespace {
+	template <typename TPool>
+	constexpr bool IsQueue = requires(TPool& pool) { pool.Configure().Options.Policy; };
+
+	/// @brief producers 个线程各放入 count 个消息，一个线程取出，统计吞吐量和收到的消息数
+	///	@details 队列使用 Block 策略，不丢弃消息；TBatchSize 大于 1 时每次通过 SetItems 放入一批消息
+	template <typename TPool, std::size_t TBatchSize = 1>
+	void MeasureThroughput(
+		Checker& check,
+		const std::string_view name,
+		const std::size_t producers,
+		const std::size_t count) {
+		Owner<TPool> pool{};
+		if constexpr (IsQueue<TPool>) {
+			const auto options = pool->Configure().Options;
+			options.Policy = OverflowPolicy::Block;
+			options.BlockTimeout = std::chrono::seconds{10};
+		}
+		std::atomic<std::size_t> running{producers};
+		std::vector<std::thread> threads{};
+
+		const auto begin = std::chrono::steady_clock::now();
+		for (std::size_t producer = 0; producer < producers; ++producer)
+			threads.emplace_back([&pool, &running, count] {
+				if constexpr (TBatchSize > 1) {
+					std::array<Message, TBatchSize> batch{};
+					for (std::size_t index = 0; index < count; index += TBatchSize) {
+						for (std::size_t offset = 0; offset < TBatchSize; ++offset)
+							batch[offset].Type = static_cast<ByteType>(index + offset);
+						pool->SetItems(batch);
+					}
+				}
+				else {
+					Message message{};
+					for (std::size_t index = 0; index < count; ++index) {
+						message.Type = static_cast<ByteType>(index);
+						pool->SetItem(message);
+					}
+				}
+				running.fetch_sub(1, std::memory_order_release);
+			});
+
+		std::size_t received = 0;
+		Message message{};
+		while (true) {
+			const auto is_running = running.load(std::memory_order_acquire) != 0;
+			while (pool->GetItem(message)) ++received;
+			if (!is_running) break;
+			std::this_thread::yield();
+		}
+		const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+		for (auto& thread : threads) thread.join();
+
+		const auto sent = producers * count;
+		std::cout << std::format(
+			"{:<40} {:>8.2f} M msg/s, received {:>6.2f}%\n",
+			name, static_cast<double>(sent) / seconds / 1e6, 100.0 * static_cast<double>(received) / sent);
+		if constexpr (IsQueue<TPool>) check(received == sent, "a blocking queue delivers every message");
+	}
+
+	/// @brief 远端一次发送 burst 个消息，统计读取消息池中能取到的消息数
+	template <typename TReaderMessagePool>
+	void MeasureBurst(Checker& check, const std::string_view name, const std::size_t burst) {
+		LoopbackTask<Message, AsyncItemPool<Message>, TReaderMessagePool> loopback{};
+		loopback.Task.Configure().Options.WriterMinInterval = std::chrono::milliseconds{1};
+		loopback.Start();
+
+		(void)loopback.Peer->WriteBytes(MakeFrames<Message>(burst));
+		std::this_thread::sleep_for(std::chrono::milliseconds{100});
+
+		std::size_t received = 0;
+		Message message{};
+		while (loopback.Utils.ReaderMessagePool->GetItem(message)) ++received;
+		loopback.Stop();
+
+		std::cout << std::format("{:<40} {:>6} of {} messages kept\n", name, received, burst);
+		if constexpr (IsQueue<TReaderMessagePool>) check(received == burst, "a queue keeps every message of a burst");
+	}
+}
+
+int main() {
+	constexpr std::size_t count = 1 << 22;
+	Checker check{};
+	MeasureThroughput<AsyncItemPool<Message>>(check, "AsyncItemPool, 1 producer", 1, count);
+	MeasureThroughput<SpscMessageQueue<Message>>(check, "SpscMessageQueue, 1 producer", 1, count);
+	MeasureThroughput<SpscMessageQueue<Message>, 16>(check, "SpscMessageQueue, 1 producer, batch 16", 1, count);
+	MeasureThroughput<AsyncItemPool<Message>>(check, "AsyncItemPool, 4 producers", 4, count / 4);
+	MeasureThroughput<MpscMessageQueue<Message>>(check, "MpscMessageQueue, 4 producers", 4, count / 4);
+	MeasureThroughput<MpscMessageQueue<Message>, 16>(check, "MpscMessageQueue, 4 producers, batch 16", 4, count / 4);
+
+	MeasureBurst<AsyncItemPool<Message>>(check, "AsyncItemPool burst", 1000);
+	MeasureBurst<SpscMessageQueue<Message>>(check, "SpscMessageQueue burst", 1000);
+	return check.GetResult();
+}
@@ -0,0 +1,71 @@
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <string_view>
+#include <thread>
+#include <Cango/ByteCommunication/Core.hpp>
+#include "TesterUtils.hpp"
+
+using namespace Cango;
+using namespace Cango::Testers;
+using Message = TypedMessage<6>;
+
+#if defined(CANGO_ENABLE_LATENCY_HISTOGRAM)
+namespace {
+	void Print(const std::string_view stage, const LatencySnapshot& snapshot) {
+		const auto microseconds = [&snapshot](const double quantile) {
+			return std::chrono::duration<double, std::micro>(snapshot.GetPercentile(quantile)).count();
+		};
+		std::cout << std::format(
+			"{:<10} count {:>6}, p50 {:>8.2f} us, p99 {:>8.2f} us, max {:>8.2f} us\n",
+			stage, snapshot.Count, microseconds(0.5), microseconds(0.99),
+			static_cast<double>(snapshot.MaxNanoseconds) / 1e3);
+	}
+}
+
+/// @brief 通过回环连接收发消息，输出各阶段的耗时
+int main() {
+	constexpr std::size_t count = 10000;
+	LoopbackTask<Message, NotifyingItemPool<Message>> loopback{};
+	Owner<PipelineLatencies> latencies{};
+	{
+		const auto config = loopback.Task.Configure();
+		config.Actors.Latencies = latencies;
+		config.Options.ReaderMinInterval = std::chrono::milliseconds{0};
+		config.Options.WriterMinInterval = std::chrono::milliseconds{0};
+	}
+	loopback.Start();
+
+	const auto& utils = loopback.Utils;
+	std::size_t echoed = 0;
+	Message message{};
+	for (std::size_t index = 0; index < count; ++index) {
+		// 远端写入的消息由读取任务取出，再通过写入任务原样发回
+		message.Type = static_cast<ByteType>(index);
+		(void)loopback.Peer->WriteBytes(message.ToSpan());
+		Message received{};
+		while (!utils.ReaderMessagePool->GetItem(received)) std::this_thread::yield();
+		utils.WriterMessagePool->SetItem(received);
+		if (!ReadWithin(*loopback.Peer, received.ToSpan(), std::chrono::seconds{1}) || received.Type != message.Type) break;
+		++echoed;
+	}
+	loopback.Stop();
+
+	const auto snapshot = latencies->Snapshot();
+	Print("read", snapshot.Read);
+	Print("frame", snapshot.Frame);
+	Print("hand-off", snapshot.HandOff);
+	Print("write", snapshot.Write);
+
+	Checker check{};
+	check(echoed == count, "every message is echoed back");
+	check(snapshot.Frame.Count == echoed && snapshot.Write.Count == echoed, "every echoed message is recorded");
+	return check.GetResult();
+}
+#else
+/// @brief 未启用 CANGO_ENABLE_LATENCY_HISTOGRAM 时不记录耗时，只输出提示
+int main() {
+	std::cout << "configure with CANGO_ENABLE_LATENCY_HISTOGRAM=ON to record latencies\n";
+	return 0;
+}
+#endif
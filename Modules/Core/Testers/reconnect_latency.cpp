@@ -0,0 +1,98 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <Cango/ByteCommunication/Core.hpp>
+#include "TesterUtils.hpp"
+
+using namespace Cango;
+using namespace Cango::Testers;
+using Message = TypedMessage<6>;
+using RWerType = LoopbackRWer<>;
+
+namespace {
+	/// @brief 扮演远端设备，连接建立后立即发送一个消息
+	struct Peer {
+		using ItemType = Owner<RWerType>;
+
+		std::mutex Mutex{};
+		Owner<RWerType> RWer{};
+		std::chrono::steady_clock::time_point ConnectTime{};
+
+		void SetItem(const Owner<RWerType>& rw) noexcept {
+			std::lock_guard lock{Mutex};
+			RWer = rw;
+			ConnectTime = std::chrono::steady_clock::now();
+			(void)RWer->WriteBytes(Message{}.ToSpan());
+		}
+
+		void Disconnect() noexcept {
+			std::lock_guard lock{Mutex};
+			if (RWer) RWer->Close();
+		}
+	};
+
+	/// @brief 记录从连接建立到收到第一个消息的时间，然后断开连接
+	struct ReconnectRecorder {
+		using ItemType = Message;
+
+		ObjectUser<Peer> PeerUser{};
+		ObjectUser<EasyDeliveryTaskMonitor> ReaderMonitor{};
+		std::mutex Mutex{};
+		std::vector<std::chrono::nanoseconds> Latencies{};
+
+		void SetItem(const Message&) noexcept {
+			const auto now = std::chrono::steady_clock::now();
+			{
+				std::lock_guard lock{Mutex};
+				std::lock_guard peer_lock{PeerUser->Mutex};
+				Latencies.push_back(now - PeerUser->ConnectTime);
+			}
+			ReaderMonitor->Interrupt();
+			PeerUser->Disconnect();
+		}
+
+		[[nodiscard]] std::size_t Count() noexcept {
+			std::lock_guard lock{Mutex};
+			return Latencies.size();
+		}
+	};
+}
+
+/// @brief 反复断开并重新连接回环读写器，统计重新连接到收到第一个消息的延迟
+int main() {
+	constexpr std::size_t count = 2000;
+	LoopbackTask<Message, AsyncItemPool<Message>, ReconnectRecorder, 1, Peer> loopback{};
+	const auto& recorder = loopback.Utils.ReaderMessagePool;
+	recorder->PeerUser = loopback.Peers;
+	recorder->ReaderMonitor = loopback.Utils.ReaderMonitor;
+	loopback.Task.Configure().Options.WriterMinInterval = std::chrono::milliseconds{1};
+	loopback.Start();
+
+	// 每次重新连接在毫秒级完成，等待时间只是防止重新连接失败时无法结束
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{30};
+	while (recorder->Count() < count && std::chrono::steady_clock::now() < deadline)
+		std::this_thread::sleep_for(std::chrono::milliseconds{1});
+	loopback.Interrupt();
+	loopback.Peers->Disconnect();
+	loopback.Stop();
+
+	Checker check{};
+	check(recorder->Count() >= count, "every reconnect delivers the first message");
+	if (recorder->Count() == 0) return check.GetResult();
+
+	auto latencies = recorder->Latencies;
+	std::ranges::sort(latencies);
+	const auto microseconds = [&latencies](const double quantile) {
+		const auto index = static_cast<std::size_t>(quantile * static_cast<double>(latencies.size() - 1));
+		return std::chrono::duration<double, std::micro>(latencies[index]).count();
+	};
+	std::cout << std::format(
+		"{} reconnects: p50 {:.1f} us, p99 {:.1f} us, max {:.1f} us\n",
+		latencies.size(), microseconds(0.5), microseconds(0.99), microseconds(1.0));
+	return check.GetResult();
+}
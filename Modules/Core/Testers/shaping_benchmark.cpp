@@ -0,0 +1,83 @@
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <Cango/ByteCommunication/Core.hpp>
+#include "TesterUtils.hpp"
+
+using namespace Cango;
+using namespace Cango::Testers;
+using Message = TypedMessage<6>;
+
+namespace {
+	struct Result {
+		std::size_t Received{0};
+		double Seconds{0};
+	};
+
+	template <typename TReader, typename TMessage, typename TVerifier>
+	using PingPongAdapter = ReaderToMessageSourceAdapter<TReader, TMessage, TVerifier>;
+
+	template <typename TReader, typename TMessage, typename TVerifier>
+	using StreamAdapter = StreamReaderToMessageSourceAdapter<TReader, TMessage, TVerifier>;
+
+	using ShaperType = ShapingRWer<LoopbackRWer<>>;
+
+	/// @brief 通过回环读写器发送 count 个消息，读取端经过 @c ShapingRWer 后由 TAdapter 分帧
+	template <template <typename, typename, typename> typename TAdapter>
+	Result Measure(const std::size_t count, const double dropProbability, const double flipProbability) {
+		LoopbackRWerPair pair{};
+		const Owner<ShaperType> shaper{};
+		{
+			const auto config = shaper->Configure();
+			config.Actors.RWer = pair.Second;
+			config.Options.DropProbability = dropProbability;
+			config.Options.FlipProbability = flipProbability;
+			config.Options.MaxChunkSize = 64;
+			config.Options.Seed = 20240601;
+		}
+
+		std::thread writer{
+			[&pair, count] {
+				const auto frames = MakeFrames<Message>(1024);
+				for (std::size_t sent = 0; sent < count; sent += 1024) (void)pair.First->WriteBytes(frames);
+				pair.First->Close();
+			}
+		};
+
+		const Owner<EndOfStreamReader<ShaperType>> reader{};
+		reader->Configure().Actors.Reader = shaper;
+		TAdapter<EndOfStreamReader<ShaperType>, Message, TailZeroVerifier> adapter{};
+		adapter.Configure().Actors.Reader = reader;
+		Result result{};
+		const auto begin = std::chrono::steady_clock::now();
+		result.Received = DrainMessages(adapter, *reader);
+		result.Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+		writer.join();
+		return result;
+	}
+}
+
+/// @brief 在不同的丢失率和损坏率下测量两种分帧适配器的送达率和吞吐量
+int main() {
+	constexpr std::size_t count = 1 << 20;
+	Checker check{};
+	std::cout << std::format("{:>10} {:>10} | {:>22} | {:>22}\n", "drop", "flip", "ping-pong", "ring framer");
+	for (const double probability : {0.0, 1e-5, 1e-4, 1e-3, 1e-2}) {
+		const auto ping_pong = Measure<PingPongAdapter>(count, probability, probability);
+		const auto stream = Measure<StreamAdapter>(count, probability, probability);
+		std::cout << std::format(
+			"{:>10.0e} {:>10.0e} | {:>7.3f}% {:>8.2f} M/s | {:>7.3f}% {:>8.2f} M/s\n",
+			probability, probability,
+			100.0 * static_cast<double>(ping_pong.Received) / count,
+			static_cast<double>(ping_pong.Received) / ping_pong.Seconds / 1e6,
+			100.0 * static_cast<double>(stream.Received) / count,
+			static_cast<double>(stream.Received) / stream.Seconds / 1e6);
+
+		check(ping_pong.Received <= count && stream.Received <= count, "no adapter emits more messages than were sent");
+		if (probability == 0)
+			check(ping_pong.Received == count && stream.Received == count, "a clean link delivers every message");
+	}
+	return check.GetResult();
+}
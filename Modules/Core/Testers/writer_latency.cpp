@@ -0,0 +1,72 @@
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <format>
+#include <iostream>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <Cango/ByteCommunication/Core.hpp>
+#include "TesterUtils.hpp"
+
+using namespace Cango;
+using namespace Cango::Testers;
+using Message = TypedMessage<6>;
+
+namespace {
+	/// @brief 测量从放入写入消息池到远端收到消息的延迟，以及空闲时任务占用的处理器时间
+	template <typename TWriterMessagePool>
+	void Measure(
+		Checker& check,
+		const std::string_view name,
+		const std::chrono::milliseconds writerMinInterval,
+		const SizeType spinCount = 0) {
+		constexpr std::size_t count = 1000;
+		LoopbackTask<Message, TWriterMessagePool> loopback{};
+		const auto& pool = loopback.Utils.WriterMessagePool;
+		if constexpr (requires { pool->Configure().Options.SpinCount; }) pool->Configure().Options.SpinCount = spinCount;
+		{
+			const auto config = loopback.Task.Configure();
+			config.Options.ReaderMinInterval = std::chrono::milliseconds{1};
+			config.Options.WriterMinInterval = writerMinInterval;
+		}
+		loopback.Start();
+
+		// 空闲时的处理器时间，包含读取任务的轮询
+		const auto idle_begin = std::clock();
+		std::this_thread::sleep_for(std::chrono::milliseconds{500});
+		const auto idle_cpu = 100.0 * static_cast<double>(std::clock() - idle_begin) / CLOCKS_PER_SEC / 0.5;
+
+		std::vector<std::chrono::nanoseconds> latencies{};
+		Message message{};
+		for (std::size_t index = 0; index < count; ++index) {
+			const auto begin = std::chrono::steady_clock::now();
+			pool->SetItem(message);
+			if (!ReadWithin(*loopback.Peer, message.ToSpan(), std::chrono::seconds{1})) break;
+			latencies.push_back(std::chrono::steady_clock::now() - begin);
+			std::this_thread::sleep_for(std::chrono::microseconds{200});
+		}
+		loopback.Stop();
+
+		check(latencies.size() == count, "every written message reaches the peer");
+		if (latencies.empty()) return;
+
+		std::ranges::sort(latencies);
+		const auto microseconds = [&latencies](const double quantile) {
+			const auto index = static_cast<std::size_t>(quantile * static_cast<double>(latencies.size() - 1));
+			return std::chrono::duration<double, std::micro>(latencies[index]).count();
+		};
+		std::cout << std::format(
+			"{:<32} p50 {:>8.1f} us, p99 {:>8.1f} us, idle cpu {:>5.1f}%\n",
+			name, microseconds(0.5), microseconds(0.99), idle_cpu);
+	}
+}
+
+int main() {
+	Checker check{};
+	Measure<AsyncItemPool<Message>>(check, "AsyncItemPool, 1 ms interval", std::chrono::milliseconds{1});
+	Measure<AsyncItemPool<Message>>(check, "AsyncItemPool, 0 ms interval", std::chrono::milliseconds{0});
+	Measure<NotifyingItemPool<Message>>(check, "NotifyingItemPool", std::chrono::milliseconds{0});
+	Measure<NotifyingItemPool<Message>>(check, "NotifyingItemPool, spin 1000", std::chrono::milliseconds{0}, 1000);
+	return check.GetResult();
+}